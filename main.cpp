@@ -12,6 +12,11 @@
 
 #include <chrono>
 #include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
 
 // Helper Functions for Pawn
 static inline cell* GetArrayPtr(AMX* amx, cell param) {
@@ -53,9 +58,16 @@ public:
         RandomixGenerators::SeedPRNG(seed);
         RandomixGenerators::SeedCSPRNG(seed);
         
+        // Default PRNG engine for scripts, e.g. RANDOMIX_ENGINE=wyrand
+        EngineKind engine;
+        if (RandomixGenerators::ParseEngineName(std::getenv("RANDOMIX_ENGINE"), engine)) {
+            RandomixGenerators::SetDefaultEngine(engine);
+        }
+        
         core_->printLn("");
         core_->printLn("  Randomix Component Loaded");
         core_->printLn("  Version: v%s", RANDOMIX_VERSION);
+        core_->printLn("  Engine: %s", RandomixGenerators::EngineName(RandomixGenerators::GetDefaultEngine()));
         core_->printLn("  Author: Fanorisky");
         core_->printLn("  GitHub: github.com/Fanorisky/PawnRandomix");
         core_->printLn("");
@@ -75,9 +87,12 @@ public:
     
     void onAmxLoad(IPawnScript& script) override {
         pawn_natives::AmxLoad(script.GetAMX());
+        RandomixGenerators::CreateContext(script.GetAMX());
     }
     
-    void onAmxUnload(IPawnScript& script) override {}
+    void onAmxUnload(IPawnScript& script) override {
+        RandomixGenerators::DestroyContext(script.GetAMX());
+    }
     
     void onReady() override {}
     
@@ -117,8 +132,9 @@ SCRIPT_API(PRandRange, int(int min, int max)) {
     if (min == max) return min;
     
     uint32_t range = static_cast<uint32_t>(max - min);
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
-    return min + static_cast<int>(RandomixGenerators::GetPRNG().next_bounded(range + 1));
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        return min + static_cast<int>(rng.next_bounded(range + 1));
+    });
 }
 
 // Random within specific range (CSPRNG)
@@ -127,8 +143,9 @@ SCRIPT_API(CSPRandRange, int(int min, int max)) {
     if (min == max) return min;
     
     uint32_t range = static_cast<uint32_t>(max - min);
-    std::lock_guard<std::mutex> lock(RandomixGenerators::csprng_mutex);
-    return min + static_cast<int>(RandomixGenerators::GetCSPRNG().next_bounded(range + 1));
+    return RandomixGenerators::VisitCSPRNG(GetAMX(), [&](auto& rng) {
+        return min + static_cast<int>(rng.next_bounded(range + 1));
+    });
 }
 
 // Random float within range (PRNG)
@@ -136,8 +153,9 @@ SCRIPT_API(PRandFloatRange, float(float min, float max)) {
     if (min > max) std::swap(min, max);
     if (min == max) return min;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
-    return min + RandomixGenerators::GetPRNG().next_float() * (max - min);
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        return min + rng.next_float() * (max - min);
+    });
 }
 
 // Random float within range (CSPRNG)
@@ -145,29 +163,91 @@ SCRIPT_API(CSPRandFloatRange, float(float min, float max)) {
     if (min > max) std::swap(min, max);
     if (min == max) return min;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::csprng_mutex);
-    return min + RandomixGenerators::GetCSPRNG().next_float() * (max - min);
+    return RandomixGenerators::VisitCSPRNG(GetAMX(), [&](auto& rng) {
+        return min + rng.next_float() * (max - min);
+    });
 }
 
 // Set seed for PRNG
 SCRIPT_API(SeedPRNG, int(int seed)) {
-    RandomixGenerators::SeedPRNG(static_cast<uint64_t>(seed));
+    RandomixGenerators::GetContext(GetAMX()).seed(static_cast<uint64_t>(seed));
+    return 1;
+}
+
+// Set seed and stream for PRNG (each stream is an independent sequence)
+SCRIPT_API(SeedPRNGStream, int(int seed, int stream)) {
+    RandomixGenerators::GetContext(GetAMX()).seed(static_cast<uint64_t>(seed), static_cast<uint64_t>(stream));
     return 1;
 }
 
+// Skip PRNG forward by a 64-bit number of draws (steps + stepsHi * 2^32)
+SCRIPT_API(PRandAdvance, bool(int steps, int stepsHi)) {
+    uint64_t delta = (static_cast<uint64_t>(static_cast<uint32_t>(stepsHi)) << 32) | static_cast<uint32_t>(steps);
+    PCG32* pcg = std::get_if<PCG32>(&RandomixGenerators::GetContext(GetAMX()).prng);
+    if (!pcg) return false;
+    
+    pcg->advance(delta);
+    return true;
+}
+
+// Rewind PRNG by a 64-bit number of draws
+SCRIPT_API(PRandBackstep, bool(int steps, int stepsHi)) {
+    uint64_t delta = (static_cast<uint64_t>(static_cast<uint32_t>(stepsHi)) << 32) | static_cast<uint32_t>(steps);
+    PCG32* pcg = std::get_if<PCG32>(&RandomixGenerators::GetContext(GetAMX()).prng);
+    if (!pcg) return false;
+    
+    pcg->backstep(delta);
+    return true;
+}
+
+// Switch this script's PRNG engine (seed 0 continues from the current engine)
+SCRIPT_API(PRandSetEngine, bool(int engine, int seed)) {
+    if (engine < 0 || engine >= static_cast<int>(std::variant_size<PRNGEngine>::value)) return false;
+    
+    ScriptContext& ctx = RandomixGenerators::GetContext(GetAMX());
+    uint64_t newSeed = static_cast<uint64_t>(seed);
+    if (newSeed == 0) {
+        newSeed = std::visit([](auto& rng) { return rng.next_uint64(); }, ctx.prng);
+    }
+    
+    ctx.set_engine(static_cast<EngineKind>(engine), newSeed);
+    return true;
+}
+
+// Current PRNG engine of this script
+SCRIPT_API(PRandGetEngine, int()) {
+    return static_cast<int>(RandomixGenerators::GetContext(GetAMX()).engine());
+}
+
 // Set seed for CSPRNG
 SCRIPT_API(SeedCSPRNG, int(int seed)) {
-    RandomixGenerators::SeedCSPRNG(static_cast<uint64_t>(seed));
+    RandomixGenerators::VisitCSPRNG(GetAMX(), [&](auto& rng) {
+        rng.seed(static_cast<uint64_t>(seed));
+    });
     return 1;
 }
 
+// Select ChaCha20/12/8 for this script's CSPRNG natives
+SCRIPT_API(CSPRandSetRounds, bool(int rounds)) {
+    if (rounds != 8 && rounds != 12 && rounds != 20) return false;
+    
+    RandomixGenerators::GetContext(GetAMX()).csprng_rounds = rounds;
+    return true;
+}
+
+// Current ChaCha round count for this script
+SCRIPT_API(CSPRandGetRounds, int()) {
+    return RandomixGenerators::GetContext(GetAMX()).csprng_rounds;
+}
+
 // Random boolean with probability (PRNG)
 SCRIPT_API(PRandBool, bool(float probability)) {
     if (probability <= 0.0f) return false;
     if (probability >= 1.0f) return true;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
-    return RandomixGenerators::GetPRNG().next_float() < probability;
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        return rng.next_float() < probability;
+    });
 }
 
 // Random boolean with probability (CSPRNG)
@@ -175,8 +255,9 @@ SCRIPT_API(CSPRandBool, bool(float probability)) {
     if (probability <= 0.0f) return false;
     if (probability >= 1.0f) return true;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::csprng_mutex);
-    return RandomixGenerators::GetCSPRNG().next_float() < probability;
+    return RandomixGenerators::VisitCSPRNG(GetAMX(), [&](auto& rng) {
+        return rng.next_float() < probability;
+    });
 }
 
 // Random boolean with weights (trueWeight vs falseWeight)
@@ -185,8 +266,9 @@ SCRIPT_API(PRandBoolWeighted, bool(int trueW, int falseW)) {
     if (falseW <= 0) return true;
 
     uint32_t total = static_cast<uint32_t>(trueW + falseW);
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
-    return RandomixGenerators::GetPRNG().next_bounded(total) < static_cast<uint32_t>(trueW);
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        return rng.next_bounded(total) < static_cast<uint32_t>(trueW);
+    });
 }
 
 // Weighted random selection
@@ -205,18 +287,19 @@ SCRIPT_API(PRandWeighted, int(cell weightsAddr, int count)) {
     
     if (total == 0) return 0;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
-    uint32_t rand = RandomixGenerators::GetPRNG().next_bounded(total);
-    uint32_t sum = 0;
-    
-    for (int i = 0; i < count; i++) {
-        if (weights[i] > 0) {
-            sum += static_cast<uint32_t>(weights[i]);
-            if (rand < sum) return i;
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        uint32_t rand = rng.next_bounded(total);
+        uint32_t sum = 0;
+        
+        for (int i = 0; i < count; i++) {
+            if (weights[i] > 0) {
+                sum += static_cast<uint32_t>(weights[i]);
+                if (rand < sum) return i;
+            }
         }
-    }
-    
-    return count - 1;
+        
+        return count - 1;
+    });
 }
 
 // Shuffle array (Fisher-Yates algorithm)
@@ -226,14 +309,14 @@ SCRIPT_API(PRandShuffle, bool(cell arrayAddr, int count)) {
     cell* array = GetArrayPtr(GetAMX(), arrayAddr);
     if (!array) return false;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
-    
-    for (int i = count - 1; i > 0; i--) {
-        int j = static_cast<int>(RandomixGenerators::GetPRNG().next_bounded(i + 1));
-        std::swap(array[i], array[j]);
-    }
-    
-    return true;
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        for (int i = count - 1; i > 0; i--) {
+            int j = static_cast<int>(rng.next_bounded(i + 1));
+            std::swap(array[i], array[j]);
+        }
+        
+        return true;
+    });
 }
 
 // Shuffle part of array (specific range)
@@ -244,78 +327,350 @@ SCRIPT_API(PRandShuffleRange, bool(cell arrayAddr, int start, int end)) {
     if (start > end) std::swap(start, end);
     if (end - start < 1) return true;
 
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        for (int i = end; i > start; i--) {
+            int j = start + rng.next_bounded(i - start + 1);
+            std::swap(array[i], array[j]);
+        }
+        return true;
+    });
+}
+
+// k distinct weighted indices in pick order (Efraimidis-Spirakis A-ExpJ)
+SCRIPT_API(PRandWeightedSample, int(cell weightsAddr, cell destAddr, int k, int count)) {
+    if (count <= 0 || k <= 0) return 0;
+    
+    cell* weights = GetArrayPtr(GetAMX(), weightsAddr);
+    cell* dest = GetArrayPtr(GetAMX(), destAddr);
+    if (!weights || !dest) return 0;
+    
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        return static_cast<int>(RandomixSampling::weighted_sample(rng, reinterpret_cast<const int32_t*>(weights),
+            static_cast<size_t>(count), static_cast<size_t>(k), reinterpret_cast<uint32_t*>(dest)));
+    });
+}
 
-    for (int i = end; i > start; i--) {
-        int j = start + RandomixGenerators::GetPRNG().next_bounded(i - start + 1);
-        std::swap(array[i], array[j]);
+// Reorder array by weighted random keys, heavier elements tend to come first
+SCRIPT_API(PRandWeightedShuffle, bool(cell arrayAddr, cell weightsAddr, int count)) {
+    if (count <= 1) return true;
+    
+    cell* array = GetArrayPtr(GetAMX(), arrayAddr);
+    cell* weights = GetArrayPtr(GetAMX(), weightsAddr);
+    if (!array || !weights) return false;
+    
+    std::vector<uint32_t> order(static_cast<size_t>(count));
+    RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        RandomixSampling::weighted_order(rng, reinterpret_cast<const int32_t*>(weights), order.size(), order.data());
+    });
+    
+    std::vector<cell> source(array, array + count);
+    for (int i = 0; i < count; i++) {
+        array[i] = source[order[i]];
     }
     return true;
 }
 
-// Gaussian/Normal distribution (Box-Muller transform)
-SCRIPT_API(PRandGaussian, int(float mean, float stddev)) {
-    if (stddev <= 0.0f) return static_cast<int>(mean);
+// k unique indices from [0, n) in O(k), no n-sized buffer (Floyd's algorithm)
+SCRIPT_API(PRandSample, int(cell destAddr, int n, int k, bool sorted)) {
+    if (n <= 0 || k <= 0) return 0;
+    
+    cell* dest = GetArrayPtr(GetAMX(), destAddr);
+    if (!dest) return 0;
+    
+    if (k > n) k = n;
+    
+    RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        RandomixSampling::uniform_sample(rng, static_cast<uint32_t>(n), static_cast<uint32_t>(k),
+            reinterpret_cast<uint32_t*>(dest), sorted);
+    });
+    return k;
+}
+
+// Fill array with integers in range, one native call for the whole array
+SCRIPT_API(PRandFill, bool(cell destAddr, int count, int min, int max)) {
+    if (count <= 0) return false;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
+    cell* dest = GetArrayPtr(GetAMX(), destAddr);
+    if (!dest) return false;
+    
+    if (min > max) std::swap(min, max);
+    uint32_t bound = static_cast<uint32_t>(max - min) + 1;
+    uint32_t* words = reinterpret_cast<uint32_t*>(dest);
     
-    float u1 = RandomixGenerators::GetPRNG().next_float();
-    float u2 = RandomixGenerators::GetPRNG().next_float();
+    RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        // bound wraps to 0 for the full 32-bit range
+        if (bound == 0) rng.fill(words, static_cast<size_t>(count));
+        else RandomixDetail::fill_bounded(rng, words, static_cast<size_t>(count), bound);
+    });
+    
+    for (int i = 0; i < count; i++) {
+        dest[i] = min + dest[i];
+    }
+    return true;
+}
+
+// Fill array with floats in [min, max)
+SCRIPT_API(PRandFloatFill, bool(cell destAddr, int count, float min, float max)) {
+    if (count <= 0) return false;
     
-    if (u1 < 1e-10f) u1 = 1e-10f;
+    cell* dest = GetArrayPtr(GetAMX(), destAddr);
+    if (!dest) return false;
     
-    float z0 = sqrtf(-2.0f * logf(u1)) * cosf(6.28318530718f * u2);
-    float result = mean + z0 * stddev;
+    if (min > max) std::swap(min, max);
     
-    return static_cast<int>(result < 0.0f ? 0.0f : result);
+    RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        for (int i = 0; i < count; i++) {
+            *reinterpret_cast<float*>(dest + i) = min + rng.next_float() * (max - min);
+        }
+    });
+    return true;
 }
 
-// D&D style dice roll (e.g., 3d6 = 3 dice with 6 sides each)
-SCRIPT_API(PRandDice, int(int sides, int count)) {
-    if (sides <= 0 || count <= 0) return 0;
+// Fill array with integers in range (CSPRNG), one lock for the whole array
+SCRIPT_API(CSPRandFill, bool(cell destAddr, int count, int min, int max)) {
+    if (count <= 0) return false;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
+    cell* dest = GetArrayPtr(GetAMX(), destAddr);
+    if (!dest) return false;
     
-    uint32_t total = 0;
-    uint32_t uSides = static_cast<uint32_t>(sides);
+    if (min > max) std::swap(min, max);
+    uint32_t bound = static_cast<uint32_t>(max - min) + 1;
+    uint32_t* words = reinterpret_cast<uint32_t*>(dest);
+    
+    RandomixGenerators::VisitCSPRNG(GetAMX(), [&](auto& rng) {
+        if (bound == 0) rng.fill(words, static_cast<size_t>(count));
+        else RandomixDetail::fill_bounded(rng, words, static_cast<size_t>(count), bound);
+    });
     
     for (int i = 0; i < count; i++) {
-        total += RandomixGenerators::GetPRNG().next_bounded(uSides) + 1;
+        dest[i] = min + dest[i];
     }
+    return true;
+}
+
+// Fill array with floats in [min, max) (CSPRNG)
+SCRIPT_API(CSPRandFloatFill, bool(cell destAddr, int count, float min, float max)) {
+    if (count <= 0) return false;
+    
+    cell* dest = GetArrayPtr(GetAMX(), destAddr);
+    if (!dest) return false;
+    
+    if (min > max) std::swap(min, max);
+    
+    RandomixGenerators::VisitCSPRNG(GetAMX(), [&](auto& rng) {
+        for (int i = 0; i < count; i++) {
+            *reinterpret_cast<float*>(dest + i) = min + rng.next_float() * (max - min);
+        }
+    });
+    return true;
+}
+
+// Gaussian/Normal distribution (Ziggurat), truncated to int and clamped at 0
+SCRIPT_API(PRandGaussian, int(float mean, float stddev)) {
+    if (stddev <= 0.0f) return static_cast<int>(mean);
     
-    return static_cast<int>(total);
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        float result = mean + RandomixNormal::next(rng) * stddev;
+        return static_cast<int>(result < 0.0f ? 0.0f : result);
+    });
 }
 
-// Generate hexadecimal token
-SCRIPT_API(CSPRandToken, int(int length)) {
-    if (length <= 0) return 0;
+// Gaussian/Normal distribution as a float
+SCRIPT_API(PRandGaussianFloat, float(float mean, float stddev)) {
+    if (stddev <= 0.0f) return mean;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::csprng_mutex);
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        return mean + RandomixNormal::next(rng) * stddev;
+    });
+}
+
+// Gaussian/Normal distribution clamped to [min, max]
+SCRIPT_API(PRandGaussianClamped, float(float mean, float stddev, float min, float max)) {
+    if (min > max) std::swap(min, max);
+    if (stddev <= 0.0f) return std::min(std::max(mean, min), max);
     
-    uint32_t token = 0;
-    int actualLength = (length > 8) ? 8 : length;
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        float result = mean + RandomixNormal::next(rng) * stddev;
+        return std::min(std::max(result, min), max);
+    });
+}
+
+// Fill array with normal floats
+SCRIPT_API(PRandGaussianFill, bool(cell destAddr, int count, float mean, float stddev)) {
+    if (count <= 0 || stddev < 0.0f) return false;
     
-    for (int i = 0; i < actualLength; i++) {
-        token = (token << 4) | (RandomixGenerators::GetCSPRNG().next_bounded(16));
-    }
+    cell* dest = GetArrayPtr(GetAMX(), destAddr);
+    if (!dest) return false;
+    
+    RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        RandomixNormal::fill(rng, reinterpret_cast<uint32_t*>(dest), static_cast<size_t>(count), mean, stddev,
+            -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity());
+    });
+    return true;
+}
+
+// Fill array with normal floats clamped to [min, max]
+SCRIPT_API(PRandGaussianFillClamped, bool(cell destAddr, int count, float mean, float stddev, float min, float max)) {
+    if (count <= 0 || stddev < 0.0f) return false;
+    
+    cell* dest = GetArrayPtr(GetAMX(), destAddr);
+    if (!dest) return false;
+    
+    if (min > max) std::swap(min, max);
+    
+    RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        RandomixNormal::fill(rng, reinterpret_cast<uint32_t*>(dest), static_cast<size_t>(count), mean, stddev, min, max);
+    });
+    return true;
+}
+
+// D&D style dice roll (e.g., 3d6 = 3 dice with 6 sides each), several dice per draw
+SCRIPT_API(PRandDice, int(int sides, int count)) {
+    if (sides <= 0 || count <= 0) return 0;
+    
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        return static_cast<int>(RandomixDice::sum(rng, static_cast<uint32_t>(sides), static_cast<uint64_t>(count)));
+    });
+}
+
+// Generate hexadecimal token
+SCRIPT_API(CSPRandToken, int(int length)) {
+    if (length <= 0) return 0;
     
-    return static_cast<int>(token);
+    return RandomixGenerators::VisitCSPRNG(GetAMX(), [&](auto& rng) {
+        uint32_t token = 0;
+        int actualLength = (length > 8) ? 8 : length;
+        
+        for (int i = 0; i < actualLength; i++) {
+            token = (token << 4) | (rng.next_bounded(16));
+        }
+        
+        return static_cast<int>(token);
+    });
 }
 
-// Generate random bytes for cryptographic purposes
+// Generate random bytes for cryptographic purposes, one byte per cell
 SCRIPT_API(CSPRandBytes, bool(cell destAddr, int length)) {
     if (length <= 0) return false;
 
     cell* dest = GetArrayPtr(GetAMX(), destAddr);
     if (!dest) return false;
 
-    std::lock_guard<std::mutex> lock(RandomixGenerators::csprng_mutex);
+    // Keystream goes into the front of the array, then widens back to front
+    uint8_t* bytes = reinterpret_cast<uint8_t*>(dest);
+    RandomixGenerators::VisitCSPRNG(GetAMX(), [&](auto& rng) {
+        rng.next_bytes(bytes, static_cast<size_t>(length));
+    });
+    
+    for (int i = length - 1; i >= 0; i--) {
+        dest[i] = static_cast<cell>(bytes[i]);
+    }
+    return true;
+}
 
-    for (int i = 0; i < length; i++) {
-        dest[i] = static_cast<cell>(
-            RandomixGenerators::GetCSPRNG().next_uint32() & 0xFF
-        );
+// Store bytes as a Pawn packed array (dest{i} is byte i, first byte in the
+// high end of each cell, unused tail bytes zeroed). Safe when bytes aliases dest.
+static void PackBytes(cell* dest, const uint8_t* bytes, size_t length) {
+    for (size_t i = 0; i < length; i += 4) {
+        uint32_t word = 0;
+        for (size_t j = 0; j < 4; j++) {
+            word = (word << 8) | (i + j < length ? bytes[i + j] : 0u);
+        }
+        dest[i / 4] = static_cast<cell>(word);
+    }
+}
+
+// Packed string with terminator, needs length / 4 + 1 cells
+static void PackString(cell* dest, const std::string& text) {
+    PackBytes(dest, reinterpret_cast<const uint8_t*>(text.data()), text.size());
+    if (text.size() % 4 == 0) {
+        dest[text.size() / 4] = 0;
     }
+}
+
+static std::string EncodeHex(const uint8_t* bytes, size_t length) {
+    static const char* hex = "0123456789abcdef";
+    std::string text;
+    text.reserve(length * 2);
+    
+    for (size_t i = 0; i < length; i++) {
+        text += hex[bytes[i] >> 4];
+        text += hex[bytes[i] & 0xF];
+    }
+    return text;
+}
+
+// RFC 4648 base64, or the URL-safe alphabet without padding
+static std::string EncodeBase64(const uint8_t* bytes, size_t length, bool urlSafe) {
+    const char* alphabet = urlSafe
+        ? "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_"
+        : "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string text;
+    text.reserve((length + 2) / 3 * 4);
+    
+    for (size_t i = 0; i < length; i += 3) {
+        uint32_t group = static_cast<uint32_t>(bytes[i]) << 16;
+        if (i + 1 < length) group |= static_cast<uint32_t>(bytes[i + 1]) << 8;
+        if (i + 2 < length) group |= bytes[i + 2];
+        
+        size_t chars = std::min<size_t>(length - i, 3) + 1;
+        for (size_t j = 0; j < 4; j++) {
+            if (j < chars) text += alphabet[(group >> (18 - 6 * j)) & 0x3F];
+            else if (!urlSafe) text += '=';
+        }
+    }
+    return text;
+}
+
+// Generate random bytes packed 4 per cell (dest{i} is byte i)
+SCRIPT_API(CSPRandBytesPacked, bool(cell destAddr, int length)) {
+    if (length <= 0) return false;
+
+    cell* dest = GetArrayPtr(GetAMX(), destAddr);
+    if (!dest) return false;
+
+    uint8_t* bytes = reinterpret_cast<uint8_t*>(dest);
+    RandomixGenerators::VisitCSPRNG(GetAMX(), [&](auto& rng) {
+        rng.next_bytes(bytes, static_cast<size_t>(length));
+    });
+    
+    PackBytes(dest, bytes, static_cast<size_t>(length));
+    return true;
+}
+
+// Random bytes as a packed lowercase hex string (2 chars per byte)
+SCRIPT_API(CSPRandHex, bool(cell destAddr, int bytes, int size)) {
+    if (bytes <= 0 || size <= 0) return false;
+    if (static_cast<int64_t>(bytes) * 2 / 4 + 1 > size) return false;
+
+    cell* dest = GetArrayPtr(GetAMX(), destAddr);
+    if (!dest) return false;
+
+    std::vector<uint8_t> raw(static_cast<size_t>(bytes));
+    RandomixGenerators::VisitCSPRNG(GetAMX(), [&](auto& rng) {
+        rng.next_bytes(raw.data(), raw.size());
+    });
+    
+    PackString(dest, EncodeHex(raw.data(), raw.size()));
+    return true;
+}
+
+// Random bytes as a packed base64 string
+SCRIPT_API(CSPRandBase64, bool(cell destAddr, int bytes, bool urlSafe, int size)) {
+    if (bytes <= 0 || size <= 0) return false;
+    
+    int64_t chars = urlSafe ? (static_cast<int64_t>(bytes) * 4 + 2) / 3 : (static_cast<int64_t>(bytes) + 2) / 3 * 4;
+    if (chars / 4 + 1 > size) return false;
+
+    cell* dest = GetArrayPtr(GetAMX(), destAddr);
+    if (!dest) return false;
+
+    std::vector<uint8_t> raw(static_cast<size_t>(bytes));
+    RandomixGenerators::VisitCSPRNG(GetAMX(), [&](auto& rng) {
+        rng.next_bytes(raw.data(), raw.size());
+    });
+    
+    PackString(dest, EncodeBase64(raw.data(), raw.size(), urlSafe));
     return true;
 }
 
@@ -325,10 +680,9 @@ SCRIPT_API(CSPRandUUID, bool(cell destAddr)) {
     if (!out) return false;
 
     uint8_t bytes[16];
-    {
-        std::lock_guard<std::mutex> lock(RandomixGenerators::csprng_mutex);
-        RandomixGenerators::GetCSPRNG().next_bytes(bytes, 16);
-    }
+    RandomixGenerators::VisitCSPRNG(GetAMX(), [&](auto& rng) {
+        rng.next_bytes(bytes, 16);
+    });
 
     bytes[6] = (bytes[6] & 0x0F) | 0x40;
     bytes[8] = (bytes[8] & 0x3F) | 0x80;
@@ -351,170 +705,338 @@ SCRIPT_API(CSPRandUUID, bool(cell destAddr)) {
 }
 
 // ============================================
-// 2D POINT FUNCTIONS - FIXED VERSION
+// 64-BIT FUNCTIONS (PCG64-DXSM)
 // ============================================
 
+static inline void Split64(uint64_t value, cell* hi, cell* lo) {
+    *hi = static_cast<cell>(static_cast<uint32_t>(value >> 32));
+    *lo = static_cast<cell>(static_cast<uint32_t>(value));
+}
+
 /**
- * Generate random point in circle (uniform distribution)
- * Uses polar rejection method for true uniform distribution
+ * Random 64-bit integer, split into high and low cells
  */
-SCRIPT_API(PRandPointInCircle, bool(float centerX, float centerY, float radius, cell outX, cell outY)) {
-    if (radius <= 0.0f) return false;
-    
-    cell* xAddr = GetArrayPtr(GetAMX(), outX);
-    cell* yAddr = GetArrayPtr(GetAMX(), outY);
-    
-    if (!xAddr || !yAddr) return false;
+SCRIPT_API(PRand64, bool(cell outHi, cell outLo)) {
+    cell* hiAddr = GetArrayPtr(GetAMX(), outHi);
+    cell* loAddr = GetArrayPtr(GetAMX(), outLo);
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
-    
-    // Square root method for uniform distribution
-    float angle = RandomixGenerators::GetPRNG().next_float() * 6.28318530718f; // 2π
-    float r = radius * sqrtf(RandomixGenerators::GetPRNG().next_float());
-    
-    *reinterpret_cast<float*>(xAddr) = centerX + r * cosf(angle);
-    *reinterpret_cast<float*>(yAddr) = centerY + r * sinf(angle);
+    if (!hiAddr || !loAddr) return false;
     
+    Split64(RandomixGenerators::GetContext(GetAMX()).prng64.next_uint64(), hiAddr, loAddr);
     return true;
 }
 
 /**
- * CSPRNG version
+ * Random 64-bit integer in [0, bound), bound given as two cells
  */
-SCRIPT_API(CSPRandPointInCircle, bool(float centerX, float centerY, float radius, cell outX, cell outY)) {
-    if (radius <= 0.0f) return false;
-    
-    cell* xAddr = GetArrayPtr(GetAMX(), outX);
-    cell* yAddr = GetArrayPtr(GetAMX(), outY);
+SCRIPT_API(PRandBounded64, bool(int boundHi, int boundLo, cell outHi, cell outLo)) {
+    uint64_t bound = (static_cast<uint64_t>(static_cast<uint32_t>(boundHi)) << 32) | static_cast<uint32_t>(boundLo);
+    if (bound == 0) return false;
     
-    if (!xAddr || !yAddr) return false;
-    
-    std::lock_guard<std::mutex> lock(RandomixGenerators::csprng_mutex);
+    cell* hiAddr = GetArrayPtr(GetAMX(), outHi);
+    cell* loAddr = GetArrayPtr(GetAMX(), outLo);
     
-    float angle = RandomixGenerators::GetCSPRNG().next_float() * 6.28318530718f;
-    float r = radius * sqrtf(RandomixGenerators::GetCSPRNG().next_float());
-    
-    *reinterpret_cast<float*>(xAddr) = centerX + r * cosf(angle);
-    *reinterpret_cast<float*>(yAddr) = centerY + r * sinf(angle);
+    if (!hiAddr || !loAddr) return false;
     
+    Split64(RandomixGenerators::GetContext(GetAMX()).prng64.next_bounded64(bound), hiAddr, loAddr);
     return true;
 }
 
 /**
- * Generate random point on circle edge (circumference)
+ * Fill array with count 64-bit values as {hi, lo} pairs (2 * count cells)
  */
-SCRIPT_API(PRandPointOnCircle, bool(float centerX, float centerY, float radius, cell outX, cell outY)) {
-    if (radius <= 0.0f) return false;
-    
-    cell* xAddr = GetArrayPtr(GetAMX(), outX);
-    cell* yAddr = GetArrayPtr(GetAMX(), outY);
-    
-    if (!xAddr || !yAddr) return false;
-    
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
+SCRIPT_API(PRand64Fill, bool(cell destAddr, int count)) {
+    if (count <= 0) return false;
     
-    float angle = RandomixGenerators::GetPRNG().next_float() * 6.28318530718f;
+    cell* dest = GetArrayPtr(GetAMX(), destAddr);
+    if (!dest) return false;
     
-    *reinterpret_cast<float*>(xAddr) = centerX + radius * cosf(angle);
-    *reinterpret_cast<float*>(yAddr) = centerY + radius * sinf(angle);
+    PCG64& rng = RandomixGenerators::GetContext(GetAMX()).prng64;
     
+    for (int i = 0; i < count; i++) {
+        Split64(rng.next_uint64(), dest + i * 2, dest + i * 2 + 1);
+    }
     return true;
 }
 
 /**
- * Generate random point in rectangle
+ * Random double in [0, 1) with 53-bit precision, as raw IEEE-754 bits
  */
-SCRIPT_API(PRandPointInRect, bool(float minX, float minY, float maxX, float maxY, cell outX, cell outY)) {
-    if (minX > maxX) std::swap(minX, maxX);
-    if (minY > maxY) std::swap(minY, maxY);
-    
-    cell* xAddr = GetArrayPtr(GetAMX(), outX);
-    cell* yAddr = GetArrayPtr(GetAMX(), outY);
-    
-    if (!xAddr || !yAddr) return false;
+SCRIPT_API(PRandDouble, bool(cell outHi, cell outLo)) {
+    cell* hiAddr = GetArrayPtr(GetAMX(), outHi);
+    cell* loAddr = GetArrayPtr(GetAMX(), outLo);
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
+    if (!hiAddr || !loAddr) return false;
     
-    *reinterpret_cast<float*>(xAddr) = minX + RandomixGenerators::GetPRNG().next_float() * (maxX - minX);
-    *reinterpret_cast<float*>(yAddr) = minY + RandomixGenerators::GetPRNG().next_float() * (maxY - minY);
+    double value = RandomixGenerators::GetContext(GetAMX()).prng64.next_double();
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
     
+    Split64(bits, hiAddr, loAddr);
     return true;
 }
 
+// ============================================
+// KEYED FUNCTIONS (PHILOX4X32-10, STATELESS)
+// ============================================
+
+static inline uint64_t Join64(int hi, int lo) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(hi)) << 32) | static_cast<uint32_t>(lo);
+}
+
 /**
- * Generate random point in ring (donut shape)
+ * Random 32-bit value for (key, counter), same result every call
  */
-SCRIPT_API(PRandPointInRing, bool(float centerX, float centerY, float innerRadius, float outerRadius, cell outX, cell outY)) {
-    if (innerRadius < 0.0f || outerRadius <= 0.0f || innerRadius >= outerRadius) return false;
-    
-    cell* xAddr = GetArrayPtr(GetAMX(), outX);
-    cell* yAddr = GetArrayPtr(GetAMX(), outY);
-    
-    if (!xAddr || !yAddr) return false;
-    
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
+SCRIPT_API(PRandKeyed, int(int key, int counter, int keyHi, int counterHi)) {
+    return static_cast<int>(Philox4x32::word(Join64(keyHi, key), Join64(counterHi, counter), 0));
+}
+
+/**
+ * Keyed random integer in range, same semantics as PRandRange
+ */
+SCRIPT_API(PRandKeyedRange, int(int min, int max, int key, int counter, int keyHi, int counterHi)) {
+    if (min > max) std::swap(min, max);
+    if (min == max) return min;
     
-    float angle = RandomixGenerators::GetPRNG().next_float() * 6.28318530718f;
+    uint32_t range = static_cast<uint32_t>(max - min);
     
-    // Uniform distribution in ring
-    float innerRadiusSq = innerRadius * innerRadius;
-    float outerRadiusSq = outerRadius * outerRadius;
-    float r = sqrtf(innerRadiusSq + RandomixGenerators::GetPRNG().next_float() * (outerRadiusSq - innerRadiusSq));
+    // Full int range: range + 1 would wrap to 0, every word is already in range
+    if (range == UINT32_MAX) return min + static_cast<int>(Philox4x32::word(Join64(keyHi, key), Join64(counterHi, counter), 0));
+    return min + static_cast<int>(Philox4x32::bounded(Join64(keyHi, key), Join64(counterHi, counter), 0, range + 1));
+}
+
+/**
+ * Keyed random float in [0, 1)
+ */
+SCRIPT_API(PRandKeyedFloat, float(int key, int counter, int keyHi, int counterHi)) {
+    return Philox4x32::word_float(Join64(keyHi, key), Join64(counterHi, counter), 0);
+}
+
+/**
+ * Fill array with the first count values of the keyed stream
+ * dest[0] matches PRandKeyed with the same key and counter
+ */
+SCRIPT_API(PRandKeyedFill, bool(cell destAddr, int count, int key, int counter, int keyHi, int counterHi)) {
+    if (count <= 0) return false;
     
-    *reinterpret_cast<float*>(xAddr) = centerX + r * cosf(angle);
-    *reinterpret_cast<float*>(yAddr) = centerY + r * sinf(angle);
+    cell* dest = GetArrayPtr(GetAMX(), destAddr);
+    if (!dest) return false;
     
+    Philox4x32::fill(reinterpret_cast<uint32_t*>(dest), static_cast<size_t>(count),
+        Join64(keyHi, key), Join64(counterHi, counter));
     return true;
 }
 
 /**
- * Generate random point in ellipse
+ * Fill array with keyed integers in range, dest[0] matches PRandKeyedRange
  */
-SCRIPT_API(PRandPointInEllipse, bool(float centerX, float centerY, float radiusX, float radiusY, cell outX, cell outY)) {
-    if (radiusX <= 0.0f || radiusY <= 0.0f) return false;
+SCRIPT_API(PRandKeyedRangeFill, bool(cell destAddr, int count, int min, int max, int key, int counter, int keyHi, int counterHi)) {
+    if (count <= 0) return false;
+    
+    cell* dest = GetArrayPtr(GetAMX(), destAddr);
+    if (!dest) return false;
+    
+    if (min > max) std::swap(min, max);
+    uint32_t range = static_cast<uint32_t>(max - min);
+    
+    // Full int range: range + 1 would wrap to 0, so take raw words
+    if (range == UINT32_MAX) {
+        Philox4x32::fill(reinterpret_cast<uint32_t*>(dest), static_cast<size_t>(count),
+            Join64(keyHi, key), Join64(counterHi, counter));
+    } else {
+        Philox4x32::fill_bounded(reinterpret_cast<uint32_t*>(dest), static_cast<size_t>(count),
+            Join64(keyHi, key), Join64(counterHi, counter), range + 1);
+    }
+    
+    for (int i = 0; i < count; i++) {
+        dest[i] = min + dest[i];
+    }
+    return true;
+}
+
+/**
+ * Fill array with keyed floats in [0, 1), dest[0] matches PRandKeyedFloat
+ */
+SCRIPT_API(PRandKeyedFloatFill, bool(cell destAddr, int count, int key, int counter, int keyHi, int counterHi)) {
+    if (count <= 0) return false;
+    
+    cell* dest = GetArrayPtr(GetAMX(), destAddr);
+    if (!dest) return false;
+    
+    uint32_t* words = reinterpret_cast<uint32_t*>(dest);
+    Philox4x32::fill(words, static_cast<size_t>(count), Join64(keyHi, key), Join64(counterHi, counter));
+    
+    for (int i = 0; i < count; i++) {
+        *reinterpret_cast<float*>(dest + i) = static_cast<float>(words[i] >> 8) / 16777216.0f;
+    }
+    return true;
+}
+
+// ============================================
+// 2D POINT FUNCTIONS - FIXED VERSION
+// ============================================
+
+/**
+ * Generate random point in circle (uniform distribution)
+ * Uses polar rejection method for true uniform distribution
+ */
+SCRIPT_API(PRandPointInCircle, bool(float centerX, float centerY, float radius, cell outX, cell outY)) {
+    if (radius <= 0.0f) return false;
     
     cell* xAddr = GetArrayPtr(GetAMX(), outX);
     cell* yAddr = GetArrayPtr(GetAMX(), outY);
     
     if (!xAddr || !yAddr) return false;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        // Square root method for uniform distribution
+        float angle = rng.next_float() * 6.28318530718f; // 2π
+        float r = radius * sqrtf(rng.next_float());
+        
+        *reinterpret_cast<float*>(xAddr) = centerX + r * cosf(angle);
+        *reinterpret_cast<float*>(yAddr) = centerY + r * sinf(angle);
+        
+        return true;
+    });
+}
+
+/**
+ * CSPRNG version
+ */
+SCRIPT_API(CSPRandPointInCircle, bool(float centerX, float centerY, float radius, cell outX, cell outY)) {
+    if (radius <= 0.0f) return false;
     
-    float angle = RandomixGenerators::GetPRNG().next_float() * 6.28318530718f;
-    float r = sqrtf(RandomixGenerators::GetPRNG().next_float());
+    cell* xAddr = GetArrayPtr(GetAMX(), outX);
+    cell* yAddr = GetArrayPtr(GetAMX(), outY);
     
-    *reinterpret_cast<float*>(xAddr) = centerX + radiusX * r * cosf(angle);
-    *reinterpret_cast<float*>(yAddr) = centerY + radiusY * r * sinf(angle);
+    if (!xAddr || !yAddr) return false;
     
-    return true;
+    return RandomixGenerators::VisitCSPRNG(GetAMX(), [&](auto& rng) {
+        float angle = rng.next_float() * 6.28318530718f;
+        float r = radius * sqrtf(rng.next_float());
+        
+        *reinterpret_cast<float*>(xAddr) = centerX + r * cosf(angle);
+        *reinterpret_cast<float*>(yAddr) = centerY + r * sinf(angle);
+        
+        return true;
+    });
 }
 
 /**
- * Generate random point in triangle
+ * Generate random point on circle edge (circumference)
  */
-SCRIPT_API(PRandPointInTriangle, bool(float x1, float y1, float x2, float y2, float x3, float y3, cell outX, cell outY)) {
+SCRIPT_API(PRandPointOnCircle, bool(float centerX, float centerY, float radius, cell outX, cell outY)) {
+    if (radius <= 0.0f) return false;
+    
+    cell* xAddr = GetArrayPtr(GetAMX(), outX);
+    cell* yAddr = GetArrayPtr(GetAMX(), outY);
+    
+    if (!xAddr || !yAddr) return false;
+    
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        float angle = rng.next_float() * 6.28318530718f;
+        
+        *reinterpret_cast<float*>(xAddr) = centerX + radius * cosf(angle);
+        *reinterpret_cast<float*>(yAddr) = centerY + radius * sinf(angle);
+        
+        return true;
+    });
+}
+
+/**
+ * Generate random point in rectangle
+ */
+SCRIPT_API(PRandPointInRect, bool(float minX, float minY, float maxX, float maxY, cell outX, cell outY)) {
+    if (minX > maxX) std::swap(minX, maxX);
+    if (minY > maxY) std::swap(minY, maxY);
+    
     cell* xAddr = GetArrayPtr(GetAMX(), outX);
     cell* yAddr = GetArrayPtr(GetAMX(), outY);
     
     if (!xAddr || !yAddr) return false;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        *reinterpret_cast<float*>(xAddr) = minX + rng.next_float() * (maxX - minX);
+        *reinterpret_cast<float*>(yAddr) = minY + rng.next_float() * (maxY - minY);
+        
+        return true;
+    });
+}
+
+/**
+ * Generate random point in ring (donut shape)
+ */
+SCRIPT_API(PRandPointInRing, bool(float centerX, float centerY, float innerRadius, float outerRadius, cell outX, cell outY)) {
+    if (innerRadius < 0.0f || outerRadius <= 0.0f || innerRadius >= outerRadius) return false;
+    
+    cell* xAddr = GetArrayPtr(GetAMX(), outX);
+    cell* yAddr = GetArrayPtr(GetAMX(), outY);
     
-    // Barycentric coordinate method
-    float r1 = RandomixGenerators::GetPRNG().next_float();
-    float r2 = RandomixGenerators::GetPRNG().next_float();
+    if (!xAddr || !yAddr) return false;
     
-    if (r1 + r2 > 1.0f) {
-        r1 = 1.0f - r1;
-        r2 = 1.0f - r2;
-    }
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        float angle = rng.next_float() * 6.28318530718f;
+        
+        // Uniform distribution in ring
+        float innerRadiusSq = innerRadius * innerRadius;
+        float outerRadiusSq = outerRadius * outerRadius;
+        float r = sqrtf(innerRadiusSq + rng.next_float() * (outerRadiusSq - innerRadiusSq));
+        
+        *reinterpret_cast<float*>(xAddr) = centerX + r * cosf(angle);
+        *reinterpret_cast<float*>(yAddr) = centerY + r * sinf(angle);
+        
+        return true;
+    });
+}
+
+/**
+ * Generate random point in ellipse
+ */
+SCRIPT_API(PRandPointInEllipse, bool(float centerX, float centerY, float radiusX, float radiusY, cell outX, cell outY)) {
+    if (radiusX <= 0.0f || radiusY <= 0.0f) return false;
     
-    float r3 = 1.0f - r1 - r2;
+    cell* xAddr = GetArrayPtr(GetAMX(), outX);
+    cell* yAddr = GetArrayPtr(GetAMX(), outY);
     
-    *reinterpret_cast<float*>(xAddr) = r1 * x1 + r2 * x2 + r3 * x3;
-    *reinterpret_cast<float*>(yAddr) = r1 * y1 + r2 * y2 + r3 * y3;
+    if (!xAddr || !yAddr) return false;
     
-    return true;
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        float angle = rng.next_float() * 6.28318530718f;
+        float r = sqrtf(rng.next_float());
+        
+        *reinterpret_cast<float*>(xAddr) = centerX + radiusX * r * cosf(angle);
+        *reinterpret_cast<float*>(yAddr) = centerY + radiusY * r * sinf(angle);
+        
+        return true;
+    });
+}
+
+/**
+ * Generate random point in triangle
+ */
+SCRIPT_API(PRandPointInTriangle, bool(float x1, float y1, float x2, float y2, float x3, float y3, cell outX, cell outY)) {
+    cell* xAddr = GetArrayPtr(GetAMX(), outX);
+    cell* yAddr = GetArrayPtr(GetAMX(), outY);
+    
+    if (!xAddr || !yAddr) return false;
+    
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        // Barycentric coordinate method
+        float r1 = rng.next_float();
+        float r2 = rng.next_float();
+        
+        if (r1 + r2 > 1.0f) {
+            r1 = 1.0f - r1;
+            r2 = 1.0f - r2;
+        }
+        
+        float r3 = 1.0f - r1 - r2;
+        
+        *reinterpret_cast<float*>(xAddr) = r1 * x1 + r2 * x2 + r3 * x3;
+        *reinterpret_cast<float*>(yAddr) = r1 * y1 + r2 * y2 + r3 * y3;
+        
+        return true;
+    });
 }
 
 // ============================================
@@ -534,25 +1056,25 @@ SCRIPT_API(PRandPointInSphere, bool(float centerX, float centerY, float centerZ,
     
     if (!xAddr || !yAddr || !zAddr) return false;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
-    
-    // Rejection method for uniform distribution in sphere
-    float x, y, z, sq;
-    do {
-        x = RandomixGenerators::GetPRNG().next_float() * 2.0f - 1.0f;
-        y = RandomixGenerators::GetPRNG().next_float() * 2.0f - 1.0f;
-        z = RandomixGenerators::GetPRNG().next_float() * 2.0f - 1.0f;
-        sq = x * x + y * y + z * z;
-    } while (sq > 1.0f || sq == 0.0f);
-    
-    // Scale to uniform distribution within sphere
-    float scale = radius * cbrtf(RandomixGenerators::GetPRNG().next_float()) / sqrtf(sq);
-    
-    *reinterpret_cast<float*>(xAddr) = centerX + x * scale;
-    *reinterpret_cast<float*>(yAddr) = centerY + y * scale;
-    *reinterpret_cast<float*>(zAddr) = centerZ + z * scale;
-    
-    return true;
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        // Rejection method for uniform distribution in sphere
+        float x, y, z, sq;
+        do {
+            x = rng.next_float() * 2.0f - 1.0f;
+            y = rng.next_float() * 2.0f - 1.0f;
+            z = rng.next_float() * 2.0f - 1.0f;
+            sq = x * x + y * y + z * z;
+        } while (sq > 1.0f || sq == 0.0f);
+        
+        // Scale to uniform distribution within sphere
+        float scale = radius * cbrtf(rng.next_float()) / sqrtf(sq);
+        
+        *reinterpret_cast<float*>(xAddr) = centerX + x * scale;
+        *reinterpret_cast<float*>(yAddr) = centerY + y * scale;
+        *reinterpret_cast<float*>(zAddr) = centerZ + z * scale;
+        
+        return true;
+    });
 }
 
 /**
@@ -567,23 +1089,23 @@ SCRIPT_API(CSPRandPointInSphere, bool(float centerX, float centerY, float center
     
     if (!xAddr || !yAddr || !zAddr) return false;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::csprng_mutex);
-    
-    float x, y, z, sq;
-    do {
-        x = RandomixGenerators::GetCSPRNG().next_float() * 2.0f - 1.0f;
-        y = RandomixGenerators::GetCSPRNG().next_float() * 2.0f - 1.0f;
-        z = RandomixGenerators::GetCSPRNG().next_float() * 2.0f - 1.0f;
-        sq = x * x + y * y + z * z;
-    } while (sq > 1.0f || sq == 0.0f);
-    
-    float scale = radius * cbrtf(RandomixGenerators::GetCSPRNG().next_float()) / sqrtf(sq);
-    
-    *reinterpret_cast<float*>(xAddr) = centerX + x * scale;
-    *reinterpret_cast<float*>(yAddr) = centerY + y * scale;
-    *reinterpret_cast<float*>(zAddr) = centerZ + z * scale;
-    
-    return true;
+    return RandomixGenerators::VisitCSPRNG(GetAMX(), [&](auto& rng) {
+        float x, y, z, sq;
+        do {
+            x = rng.next_float() * 2.0f - 1.0f;
+            y = rng.next_float() * 2.0f - 1.0f;
+            z = rng.next_float() * 2.0f - 1.0f;
+            sq = x * x + y * y + z * z;
+        } while (sq > 1.0f || sq == 0.0f);
+        
+        float scale = radius * cbrtf(rng.next_float()) / sqrtf(sq);
+        
+        *reinterpret_cast<float*>(xAddr) = centerX + x * scale;
+        *reinterpret_cast<float*>(yAddr) = centerY + y * scale;
+        *reinterpret_cast<float*>(zAddr) = centerZ + z * scale;
+        
+        return true;
+    });
 }
 
 /**
@@ -599,23 +1121,23 @@ SCRIPT_API(PRandPointOnSphere, bool(float centerX, float centerY, float centerZ,
     
     if (!xAddr || !yAddr || !zAddr) return false;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
-    
-    // Marsaglia's method for uniform distribution on sphere surface
-    float u, v, s;
-    do {
-        u = RandomixGenerators::GetPRNG().next_float() * 2.0f - 1.0f;
-        v = RandomixGenerators::GetPRNG().next_float() * 2.0f - 1.0f;
-        s = u * u + v * v;
-    } while (s >= 1.0f || s == 0.0f);
-    
-    float multiplier = 2.0f * sqrtf(1.0f - s);
-    
-    *reinterpret_cast<float*>(xAddr) = centerX + radius * u * multiplier;
-    *reinterpret_cast<float*>(yAddr) = centerY + radius * v * multiplier;
-    *reinterpret_cast<float*>(zAddr) = centerZ + radius * (1.0f - 2.0f * s);
-    
-    return true;
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        // Marsaglia's method for uniform distribution on sphere surface
+        float u, v, s;
+        do {
+            u = rng.next_float() * 2.0f - 1.0f;
+            v = rng.next_float() * 2.0f - 1.0f;
+            s = u * u + v * v;
+        } while (s >= 1.0f || s == 0.0f);
+        
+        float multiplier = 2.0f * sqrtf(1.0f - s);
+        
+        *reinterpret_cast<float*>(xAddr) = centerX + radius * u * multiplier;
+        *reinterpret_cast<float*>(yAddr) = centerY + radius * v * multiplier;
+        *reinterpret_cast<float*>(zAddr) = centerZ + radius * (1.0f - 2.0f * s);
+        
+        return true;
+    });
 }
 
 /**
@@ -632,13 +1154,13 @@ SCRIPT_API(PRandPointInBox, bool(float minX, float minY, float minZ, float maxX,
     
     if (!xAddr || !yAddr || !zAddr) return false;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
-    
-    *reinterpret_cast<float*>(xAddr) = minX + RandomixGenerators::GetPRNG().next_float() * (maxX - minX);
-    *reinterpret_cast<float*>(yAddr) = minY + RandomixGenerators::GetPRNG().next_float() * (maxY - minY);
-    *reinterpret_cast<float*>(zAddr) = minZ + RandomixGenerators::GetPRNG().next_float() * (maxZ - minZ);
-    
-    return true;
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        *reinterpret_cast<float*>(xAddr) = minX + rng.next_float() * (maxX - minX);
+        *reinterpret_cast<float*>(yAddr) = minY + rng.next_float() * (maxY - minY);
+        *reinterpret_cast<float*>(zAddr) = minZ + rng.next_float() * (maxZ - minZ);
+        
+        return true;
+    });
 }
 
 // ============================================
@@ -646,8 +1168,11 @@ SCRIPT_API(PRandPointInBox, bool(float minX, float minY, float minZ, float maxX,
 // ============================================
 
 /**
- * Generate random point in convex polygon (2D)
- * Uses triangulation method
+ * Generate random point in a polygon (2D), concave outlines included
+ * Ear-clips on every call (O(n^2), ~3 ms at 1024 vertices); PRandPolygonCreate
+ * caches the triangulation for static zones.
+ * Outlines the triangulation rejects (over 1024 vertices, crossing edges)
+ * fall back to the original fan from vertex 0.
  */
 SCRIPT_API(PRandPointInPolygon, bool(cell verticesAddr, int vertexCount, cell outX, cell outY)) {
     if (vertexCount < 3) return false;
@@ -658,64 +1183,926 @@ SCRIPT_API(PRandPointInPolygon, bool(cell verticesAddr, int vertexCount, cell ou
     
     if (!verticesPtr || !xAddr || !yAddr) return false;
     
-    // Cast to float pointer for easier access
-    float* vertices = reinterpret_cast<float*>(verticesPtr);
+    const float* vertices = reinterpret_cast<float*>(verticesPtr);
+    float& x = *reinterpret_cast<float*>(xAddr);
+    float& y = *reinterpret_cast<float*>(yAddr);
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
+    Polygon polygon;
+    bool clipped = polygon.set_outline(vertices, static_cast<size_t>(vertexCount));
     
-    // Calculate total area using triangulation from first vertex
-    float totalArea = 0.0f;
-    std::vector<float> triangleAreas;
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        if (!clipped) return Polygon::sample_fan(rng, vertices, static_cast<size_t>(vertexCount), x, y);
+        polygon.sample(rng, x, y);
+        return true;
+    });
+}
+
+// ============================================
+// BATCH POINT FUNCTIONS
+// ============================================
+
+// Raw draws for the RandomixGeometry kernels, one engine visit per batch
+static std::vector<uint32_t> DrawPointWords(AMX* amx, size_t planes, int count) {
+    std::vector<uint32_t> words(planes * static_cast<size_t>(count));
+    RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        rng.fill(words.data(), words.size());
+    });
+    return words;
+}
+
+/**
+ * Fill X/Y arrays with count uniform points in a circle
+ */
+SCRIPT_API(PRandPointsInCircle, bool(float centerX, float centerY, float radius, cell outX, cell outY, int count)) {
+    if (count <= 0 || radius <= 0.0f) return false;
     
-    for (int i = 1; i < vertexCount - 1; i++) {
-        float x1 = vertices[0];
-        float y1 = vertices[1];
-        float x2 = vertices[i * 2];
-        float y2 = vertices[i * 2 + 1];
-        float x3 = vertices[(i + 1) * 2];
-        float y3 = vertices[(i + 1) * 2 + 1];
-        
-        // Triangle area using cross product
-        float area = fabsf((x2 - x1) * (y3 - y1) - (x3 - x1) * (y2 - y1)) * 0.5f;
-        triangleAreas.push_back(area);
-        totalArea += area;
-    }
+    cell* xAddr = GetArrayPtr(GetAMX(), outX);
+    cell* yAddr = GetArrayPtr(GetAMX(), outY);
+    
+    if (!xAddr || !yAddr) return false;
+    
+    std::vector<uint32_t> words = DrawPointWords(GetAMX(), RandomixGeometry::DISC_DRAWS, count);
+    RandomixGeometry::disc(words.data(), static_cast<size_t>(count), centerX, centerY, radius, radius, 0.0f, 1.0f,
+        reinterpret_cast<float*>(xAddr), reinterpret_cast<float*>(yAddr));
+    return true;
+}
+
+/**
+ * Fill X/Y arrays with count points on a circle edge
+ */
+SCRIPT_API(PRandPointsOnCircle, bool(float centerX, float centerY, float radius, cell outX, cell outY, int count)) {
+    if (count <= 0 || radius <= 0.0f) return false;
     
-    if (totalArea <= 0.0f) return false;
+    cell* xAddr = GetArrayPtr(GetAMX(), outX);
+    cell* yAddr = GetArrayPtr(GetAMX(), outY);
     
-    // Select random triangle based on area weights
-    float rand = RandomixGenerators::GetPRNG().next_float() * totalArea;
-    float sum = 0.0f;
-    int selectedTriangle = 0;
+    if (!xAddr || !yAddr) return false;
     
-    for (size_t i = 0; i < triangleAreas.size(); i++) {
-        sum += triangleAreas[i];
-        if (rand < sum) {
-            selectedTriangle = static_cast<int>(i);
-            break;
-        }
-    }
+    std::vector<uint32_t> words = DrawPointWords(GetAMX(), RandomixGeometry::CIRCLE_EDGE_DRAWS, count);
+    RandomixGeometry::circle_edge(words.data(), static_cast<size_t>(count), centerX, centerY, radius,
+        reinterpret_cast<float*>(xAddr), reinterpret_cast<float*>(yAddr));
+    return true;
+}
+
+/**
+ * Fill X/Y arrays with count uniform points in a ring
+ */
+SCRIPT_API(PRandPointsInRing, bool(float centerX, float centerY, float innerRadius, float outerRadius, cell outX, cell outY, int count)) {
+    if (count <= 0 || innerRadius < 0.0f || outerRadius <= 0.0f || innerRadius >= outerRadius) return false;
     
-    // Generate point in selected triangle
-    float x1 = vertices[0];
-    float y1 = vertices[1];
-    float x2 = vertices[(selectedTriangle + 1) * 2];
-    float y2 = vertices[(selectedTriangle + 1) * 2 + 1];
-    float x3 = vertices[(selectedTriangle + 2) * 2];
-    float y3 = vertices[(selectedTriangle + 2) * 2 + 1];
+    cell* xAddr = GetArrayPtr(GetAMX(), outX);
+    cell* yAddr = GetArrayPtr(GetAMX(), outY);
     
-    float r1 = RandomixGenerators::GetPRNG().next_float();
-    float r2 = RandomixGenerators::GetPRNG().next_float();
+    if (!xAddr || !yAddr) return false;
     
-    if (r1 + r2 > 1.0f) {
-        r1 = 1.0f - r1;
-        r2 = 1.0f - r2;
-    }
+    std::vector<uint32_t> words = DrawPointWords(GetAMX(), RandomixGeometry::DISC_DRAWS, count);
+    RandomixGeometry::disc(words.data(), static_cast<size_t>(count), centerX, centerY, 1.0f, 1.0f,
+        innerRadius * innerRadius, outerRadius * outerRadius - innerRadius * innerRadius,
+        reinterpret_cast<float*>(xAddr), reinterpret_cast<float*>(yAddr));
+    return true;
+}
+
+/**
+ * Fill X/Y arrays with count uniform points in an ellipse
+ */
+SCRIPT_API(PRandPointsInEllipse, bool(float centerX, float centerY, float radiusX, float radiusY, cell outX, cell outY, int count)) {
+    if (count <= 0 || radiusX <= 0.0f || radiusY <= 0.0f) return false;
+    
+    cell* xAddr = GetArrayPtr(GetAMX(), outX);
+    cell* yAddr = GetArrayPtr(GetAMX(), outY);
     
-    float r3 = 1.0f - r1 - r2;
+    if (!xAddr || !yAddr) return false;
+    
+    std::vector<uint32_t> words = DrawPointWords(GetAMX(), RandomixGeometry::DISC_DRAWS, count);
+    RandomixGeometry::disc(words.data(), static_cast<size_t>(count), centerX, centerY, radiusX, radiusY, 0.0f, 1.0f,
+        reinterpret_cast<float*>(xAddr), reinterpret_cast<float*>(yAddr));
+    return true;
+}
+
+/**
+ * Fill X/Y arrays with count uniform points in a rectangle
+ */
+SCRIPT_API(PRandPointsInRect, bool(float minX, float minY, float maxX, float maxY, cell outX, cell outY, int count)) {
+    if (count <= 0) return false;
+    
+    cell* xAddr = GetArrayPtr(GetAMX(), outX);
+    cell* yAddr = GetArrayPtr(GetAMX(), outY);
+    
+    if (!xAddr || !yAddr) return false;
+    
+    std::vector<uint32_t> words = DrawPointWords(GetAMX(), RandomixGeometry::RECT_DRAWS, count);
+    RandomixGeometry::rect(words.data(), static_cast<size_t>(count), minX, minY, maxX, maxY,
+        reinterpret_cast<float*>(xAddr), reinterpret_cast<float*>(yAddr));
+    return true;
+}
+
+/**
+ * Fill X/Y/Z arrays with count uniform points in a sphere (rejection-free)
+ */
+SCRIPT_API(PRandPointsInSphere, bool(float centerX, float centerY, float centerZ, float radius, cell outX, cell outY, cell outZ, int count)) {
+    if (count <= 0 || radius <= 0.0f) return false;
+    
+    cell* xAddr = GetArrayPtr(GetAMX(), outX);
+    cell* yAddr = GetArrayPtr(GetAMX(), outY);
+    cell* zAddr = GetArrayPtr(GetAMX(), outZ);
+    
+    if (!xAddr || !yAddr || !zAddr) return false;
+    
+    std::vector<uint32_t> words = DrawPointWords(GetAMX(), RandomixGeometry::SPHERE_DRAWS, count);
+    RandomixGeometry::sphere(words.data(), static_cast<size_t>(count), centerX, centerY, centerZ, radius,
+        reinterpret_cast<float*>(xAddr), reinterpret_cast<float*>(yAddr), reinterpret_cast<float*>(zAddr));
+    return true;
+}
+
+/**
+ * Fill X/Y/Z arrays with count uniform points on a sphere surface
+ */
+SCRIPT_API(PRandPointsOnSphere, bool(float centerX, float centerY, float centerZ, float radius, cell outX, cell outY, cell outZ, int count)) {
+    if (count <= 0 || radius <= 0.0f) return false;
+    
+    cell* xAddr = GetArrayPtr(GetAMX(), outX);
+    cell* yAddr = GetArrayPtr(GetAMX(), outY);
+    cell* zAddr = GetArrayPtr(GetAMX(), outZ);
+    
+    if (!xAddr || !yAddr || !zAddr) return false;
+    
+    std::vector<uint32_t> words = DrawPointWords(GetAMX(), RandomixGeometry::SPHERE_SURFACE_DRAWS, count);
+    RandomixGeometry::sphere_surface(words.data(), static_cast<size_t>(count), centerX, centerY, centerZ, radius,
+        reinterpret_cast<float*>(xAddr), reinterpret_cast<float*>(yAddr), reinterpret_cast<float*>(zAddr));
+    return true;
+}
+
+/**
+ * Fill X/Y/Z arrays with count uniform points in a box
+ */
+SCRIPT_API(PRandPointsInBox, bool(float minX, float minY, float minZ, float maxX, float maxY, float maxZ, cell outX, cell outY, cell outZ, int count)) {
+    if (count <= 0) return false;
+    
+    cell* xAddr = GetArrayPtr(GetAMX(), outX);
+    cell* yAddr = GetArrayPtr(GetAMX(), outY);
+    cell* zAddr = GetArrayPtr(GetAMX(), outZ);
     
-    *reinterpret_cast<float*>(xAddr) = r1 * x1 + r2 * x2 + r3 * x3;
-    *reinterpret_cast<float*>(yAddr) = r1 * y1 + r2 * y2 + r3 * y3;
+    if (!xAddr || !yAddr || !zAddr) return false;
     
+    std::vector<uint32_t> words = DrawPointWords(GetAMX(), RandomixGeometry::BOX_DRAWS, count);
+    RandomixGeometry::box(words.data(), static_cast<size_t>(count), minX, minY, minZ, maxX, maxY, maxZ,
+        reinterpret_cast<float*>(xAddr), reinterpret_cast<float*>(yAddr), reinterpret_cast<float*>(zAddr));
     return true;
-}
\ No newline at end of file
+}
+
+// ============================================
+// ALIAS TABLE FUNCTIONS
+// ============================================
+
+/**
+ * Build an O(1) weighted sampler from a weights array
+ * Returns a handle (0 if no weight is positive)
+ */
+SCRIPT_API(PRandAliasCreate, int(cell weightsAddr, int count)) {
+    if (count <= 0) return 0;
+    
+    cell* weights = GetArrayPtr(GetAMX(), weightsAddr);
+    if (!weights) return 0;
+    
+    std::unique_ptr<AliasTable> table(new AliasTable());
+    if (!table->build(reinterpret_cast<const int32_t*>(weights), static_cast<size_t>(count))) return 0;
+    
+    return RandomixGenerators::GetContext(GetAMX()).alias_tables.add(std::move(table));
+}
+
+/**
+ * Pick one index from an alias table, -1 for an invalid handle
+ */
+SCRIPT_API(PRandAliasPick, int(int handle)) {
+    const AliasTable* table = RandomixGenerators::GetContext(GetAMX()).alias_tables.get(handle);
+    if (!table) return -1;
+    
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        return static_cast<int>(table->pick(rng));
+    });
+}
+
+/**
+ * Fill array with count independent picks from an alias table
+ */
+SCRIPT_API(PRandAliasPickMany, bool(int handle, cell destAddr, int count)) {
+    if (count <= 0) return false;
+    
+    const AliasTable* table = RandomixGenerators::GetContext(GetAMX()).alias_tables.get(handle);
+    if (!table) return false;
+    
+    cell* dest = GetArrayPtr(GetAMX(), destAddr);
+    if (!dest) return false;
+    
+    RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        for (int i = 0; i < count; i++) {
+            dest[i] = static_cast<cell>(table->pick(rng));
+        }
+    });
+    return true;
+}
+
+/**
+ * Free an alias table (tables are also freed when the script unloads)
+ */
+SCRIPT_API(PRandAliasDestroy, bool(int handle)) {
+    return RandomixGenerators::GetContext(GetAMX()).alias_tables.remove(handle);
+}
+
+// ============================================
+// WEIGHTED SET FUNCTIONS
+// ============================================
+
+/**
+ * Create a weighted set of size entries, all with weight 0
+ */
+SCRIPT_API(PRandWeightedSetCreate, int(int size)) {
+    if (size <= 0 || static_cast<size_t>(size) > WeightedSet::MAX_SIZE) return 0;
+    
+    std::unique_ptr<WeightedSet> set(new WeightedSet(static_cast<size_t>(size)));
+    return RandomixGenerators::GetContext(GetAMX()).weighted_sets.add(std::move(set));
+}
+
+/**
+ * Create a weighted set from a weights array in O(n)
+ */
+SCRIPT_API(PRandWeightedSetFromArray, int(cell weightsAddr, int count)) {
+    if (count <= 0 || static_cast<size_t>(count) > WeightedSet::MAX_SIZE) return 0;
+    
+    cell* weights = GetArrayPtr(GetAMX(), weightsAddr);
+    if (!weights) return 0;
+    
+    std::unique_ptr<WeightedSet> set(new WeightedSet(static_cast<size_t>(count)));
+    set->assign(reinterpret_cast<const int32_t*>(weights), static_cast<size_t>(count));
+    return RandomixGenerators::GetContext(GetAMX()).weighted_sets.add(std::move(set));
+}
+
+/**
+ * Change one weight in O(log n), non-positive weights remove the entry
+ */
+SCRIPT_API(PRandWeightedSetSetWeight, bool(int handle, int index, int weight)) {
+    WeightedSet* set = RandomixGenerators::GetContext(GetAMX()).weighted_sets.get(handle);
+    if (!set || index < 0 || static_cast<size_t>(index) >= set->size()) return false;
+    
+    set->set_weight(static_cast<size_t>(index), weight > 0 ? static_cast<uint32_t>(weight) : 0u);
+    return true;
+}
+
+/**
+ * Current weight of one entry, -1 for an invalid handle or index
+ */
+SCRIPT_API(PRandWeightedSetGetWeight, int(int handle, int index)) {
+    WeightedSet* set = RandomixGenerators::GetContext(GetAMX()).weighted_sets.get(handle);
+    if (!set || index < 0 || static_cast<size_t>(index) >= set->size()) return -1;
+    
+    return static_cast<int>(set->weight(static_cast<size_t>(index)));
+}
+
+/**
+ * Pick one index by weight in O(log n), -1 if the set is empty
+ */
+SCRIPT_API(PRandWeightedSetPick, int(int handle)) {
+    WeightedSet* set = RandomixGenerators::GetContext(GetAMX()).weighted_sets.get(handle);
+    if (!set || set->total() == 0) return -1;
+    
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        return static_cast<int>(set->pick(rng));
+    });
+}
+
+/**
+ * Pick one index by weight and set its weight to 0, -1 if the set is empty
+ */
+SCRIPT_API(PRandWeightedSetPickAndRemove, int(int handle)) {
+    WeightedSet* set = RandomixGenerators::GetContext(GetAMX()).weighted_sets.get(handle);
+    if (!set || set->total() == 0) return -1;
+    
+    size_t index = RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        return set->pick(rng);
+    });
+    set->set_weight(index, 0);
+    return static_cast<int>(index);
+}
+
+/**
+ * Free a weighted set (sets are also freed when the script unloads)
+ */
+SCRIPT_API(PRandWeightedSetDestroy, bool(int handle)) {
+    return RandomixGenerators::GetContext(GetAMX()).weighted_sets.remove(handle);
+}
+
+// ============================================
+// DECK FUNCTIONS
+// ============================================
+
+// Runs fn on the generator a deck was created with
+template <typename F>
+static auto VisitDeck(AMX* amx, const Deck& deck, F&& fn) -> decltype(fn(std::declval<PCG32&>())) {
+    if (deck.source == Deck::Source::CSPRNG) {
+        return RandomixGenerators::VisitCSPRNG(amx, std::forward<F>(fn));
+    }
+    return RandomixGenerators::VisitPRNG(amx, std::forward<F>(fn));
+}
+
+/**
+ * Create a shoe of decks * deckSize cards, already shuffled
+ * source 0 draws from the script's PRNG, 1 from ChaCha
+ */
+SCRIPT_API(PRandDeckCreate, int(int deckSize, int decks, int source)) {
+    if (deckSize <= 0 || decks <= 0 || source < 0 || source > 1) return 0;
+    if (static_cast<uint64_t>(deckSize) * static_cast<uint64_t>(decks) > Deck::MAX_CARDS) return 0;
+    
+    std::unique_ptr<Deck> deck(new Deck(static_cast<uint32_t>(deckSize), static_cast<uint32_t>(decks),
+        static_cast<Deck::Source>(source)));
+    return RandomixGenerators::GetContext(GetAMX()).decks.add(std::move(deck));
+}
+
+/**
+ * Deal one card (value in [0, deckSize)), -1 if the shoe is empty
+ */
+SCRIPT_API(PRandDeckDraw, int(int handle)) {
+    Deck* deck = RandomixGenerators::GetContext(GetAMX()).decks.get(handle);
+    if (!deck) return -1;
+    
+    return VisitDeck(GetAMX(), *deck, [&](auto& rng) {
+        return deck->draw(rng);
+    });
+}
+
+/**
+ * Deal up to count cards into dest, returns the number dealt
+ */
+SCRIPT_API(PRandDeckDrawMany, int(int handle, cell destAddr, int count)) {
+    if (count <= 0) return 0;
+    
+    Deck* deck = RandomixGenerators::GetContext(GetAMX()).decks.get(handle);
+    if (!deck) return 0;
+    
+    cell* dest = GetArrayPtr(GetAMX(), destAddr);
+    if (!dest) return 0;
+    
+    return VisitDeck(GetAMX(), *deck, [&](auto& rng) {
+        int dealt = 0;
+        while (dealt < count) {
+            int card = deck->draw(rng);
+            if (card < 0) break;
+            dest[dealt++] = card;
+        }
+        return dealt;
+    });
+}
+
+/**
+ * Return every card to the shoe and place a new cut card, O(1)
+ */
+SCRIPT_API(PRandDeckShuffle, bool(int handle)) {
+    Deck* deck = RandomixGenerators::GetContext(GetAMX()).decks.get(handle);
+    if (!deck) return false;
+    
+    VisitDeck(GetAMX(), *deck, [&](auto& rng) {
+        deck->shuffle(rng);
+    });
+    return true;
+}
+
+/**
+ * Cards left in the shoe, -1 for an invalid handle
+ */
+SCRIPT_API(PRandDeckRemaining, int(int handle)) {
+    Deck* deck = RandomixGenerators::GetContext(GetAMX()).decks.get(handle);
+    if (!deck) return -1;
+    
+    return static_cast<int>(deck->remaining());
+}
+
+/**
+ * Place the cut card between minDealt and maxDealt cards (maxDealt 0 removes it)
+ */
+SCRIPT_API(PRandDeckSetCut, bool(int handle, int minDealt, int maxDealt)) {
+    Deck* deck = RandomixGenerators::GetContext(GetAMX()).decks.get(handle);
+    if (!deck || minDealt < 0 || maxDealt < 0) return false;
+    
+    VisitDeck(GetAMX(), *deck, [&](auto& rng) {
+        deck->set_cut(rng, static_cast<size_t>(minDealt), static_cast<size_t>(maxDealt));
+    });
+    return true;
+}
+
+/**
+ * Whether the cut card has come out since the last shuffle
+ */
+SCRIPT_API(PRandDeckCutReached, bool(int handle)) {
+    Deck* deck = RandomixGenerators::GetContext(GetAMX()).decks.get(handle);
+    return deck && deck->cut_reached();
+}
+
+/**
+ * Reshuffle automatically when a draw finds threshold or fewer cards left (-1 disables)
+ */
+SCRIPT_API(PRandDeckSetAutoShuffle, bool(int handle, int threshold)) {
+    Deck* deck = RandomixGenerators::GetContext(GetAMX()).decks.get(handle);
+    if (!deck) return false;
+    
+    deck->set_auto_shuffle(threshold < 0 ? -1 : threshold);
+    return true;
+}
+
+/**
+ * Free a deck (decks are also freed when the script unloads)
+ */
+SCRIPT_API(PRandDeckDestroy, bool(int handle)) {
+    return RandomixGenerators::GetContext(GetAMX()).decks.remove(handle);
+}
+
+// ============================================
+// PERMUTATION FUNCTIONS
+// ============================================
+
+/**
+ * Create a keyed permutation of [0, n)
+ * A non-zero key expands through PCG32 and always gives the same order;
+ * key 0 takes fresh round keys from ChaCha
+ */
+SCRIPT_API(PRandPermCreate, int(int n, int key, int keyHi)) {
+    if (n <= 0) return 0;
+    
+    std::unique_ptr<FeistelPermutation> perm;
+    uint64_t seed = Join64(keyHi, key);
+    
+    if (seed != 0) {
+        PCG32 rng(seed);
+        perm.reset(new FeistelPermutation(static_cast<uint32_t>(n), rng));
+    } else {
+        RandomixGenerators::VisitCSPRNG(GetAMX(), [&](auto& rng) {
+            perm.reset(new FeistelPermutation(static_cast<uint32_t>(n), rng));
+        });
+    }
+    return RandomixGenerators::GetContext(GetAMX()).permutations.add(std::move(perm));
+}
+
+/**
+ * Value at position index, -1 if the handle or index is invalid
+ */
+SCRIPT_API(PRandPermGet, int(int handle, int index)) {
+    const FeistelPermutation* perm = RandomixGenerators::GetContext(GetAMX()).permutations.get(handle);
+    if (!perm || index < 0 || static_cast<uint32_t>(index) >= perm->size()) return -1;
+    
+    return static_cast<int>(perm->forward(static_cast<uint32_t>(index)));
+}
+
+/**
+ * Position of value, -1 if the handle or value is invalid
+ */
+SCRIPT_API(PRandPermInverse, int(int handle, int value)) {
+    const FeistelPermutation* perm = RandomixGenerators::GetContext(GetAMX()).permutations.get(handle);
+    if (!perm || value < 0 || static_cast<uint32_t>(value) >= perm->size()) return -1;
+    
+    return static_cast<int>(perm->inverse(static_cast<uint32_t>(value)));
+}
+
+/**
+ * Free a permutation (permutations are also freed when the script unloads)
+ */
+SCRIPT_API(PRandPermDestroy, bool(int handle)) {
+    return RandomixGenerators::GetContext(GetAMX()).permutations.remove(handle);
+}
+
+// ============================================
+// DICE EXPRESSION FUNCTIONS
+// ============================================
+
+/**
+ * Roll a dice expression such as "4d6kh3" or "2d20k + 5"
+ * The compiled form is cached per script, 0 if the expression is invalid
+ */
+SCRIPT_API(PRandDiceRoll, int(const std::string& expression)) {
+    const DiceExpression* expr = RandomixGenerators::GetContext(GetAMX()).dice(expression);
+    if (!expr) return 0;
+    
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        return static_cast<int>(expr->roll(rng));
+    });
+}
+
+/**
+ * Compile a dice expression into a handle, 0 if it is invalid
+ */
+SCRIPT_API(PRandDiceCompile, int(const std::string& expression)) {
+    std::unique_ptr<DiceExpression> expr(new DiceExpression());
+    if (!expr->parse(expression.c_str())) return 0;
+    
+    return RandomixGenerators::GetContext(GetAMX()).dice_expressions.add(std::move(expr));
+}
+
+/**
+ * Roll a compiled dice expression, 0 for an invalid handle
+ */
+SCRIPT_API(PRandDiceEval, int(int handle)) {
+    const DiceExpression* expr = RandomixGenerators::GetContext(GetAMX()).dice_expressions.get(handle);
+    if (!expr) return 0;
+    
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        return static_cast<int>(expr->roll(rng));
+    });
+}
+
+/**
+ * Roll a compiled dice expression count times into dest (one roll per player)
+ */
+SCRIPT_API(PRandDiceEvalMany, bool(int handle, cell destAddr, int count)) {
+    if (count <= 0) return false;
+    
+    const DiceExpression* expr = RandomixGenerators::GetContext(GetAMX()).dice_expressions.get(handle);
+    if (!expr) return false;
+    
+    cell* dest = GetArrayPtr(GetAMX(), destAddr);
+    if (!dest) return false;
+    
+    RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        for (int i = 0; i < count; i++) {
+            dest[i] = static_cast<cell>(expr->roll(rng));
+        }
+    });
+    return true;
+}
+
+/**
+ * Free a compiled dice expression (also freed when the script unloads)
+ */
+SCRIPT_API(PRandDiceFree, bool(int handle)) {
+    return RandomixGenerators::GetContext(GetAMX()).dice_expressions.remove(handle);
+}
+
+// ============================================
+// POLYGON FUNCTIONS
+// ============================================
+
+/**
+ * Triangulate a polygon once into a handle, 0 if it is degenerate,
+ * self-intersecting or over Polygon::MAX_VERTICES
+ */
+SCRIPT_API(PRandPolygonCreate, int(cell verticesAddr, int vertexCount)) {
+    if (vertexCount < 3) return 0;
+    
+    cell* verticesPtr = GetArrayPtr(GetAMX(), verticesAddr);
+    if (!verticesPtr) return 0;
+    
+    std::unique_ptr<Polygon> polygon(new Polygon());
+    if (!polygon->set_outline(reinterpret_cast<float*>(verticesPtr), static_cast<size_t>(vertexCount))) return 0;
+    
+    return RandomixGenerators::GetContext(GetAMX()).polygons.add(std::move(polygon));
+}
+
+/**
+ * Cut a hole out of a polygon, the polygon is unchanged on failure
+ */
+SCRIPT_API(PRandPolygonAddHole, bool(int handle, cell verticesAddr, int vertexCount)) {
+    Polygon* polygon = RandomixGenerators::GetContext(GetAMX()).polygons.get(handle);
+    if (!polygon || vertexCount < 3) return false;
+    
+    cell* verticesPtr = GetArrayPtr(GetAMX(), verticesAddr);
+    if (!verticesPtr) return false;
+    
+    return polygon->add_hole(reinterpret_cast<float*>(verticesPtr), static_cast<size_t>(vertexCount));
+}
+
+/**
+ * Generate random point in a cached polygon
+ */
+SCRIPT_API(PRandPolygonPoint, bool(int handle, cell outX, cell outY)) {
+    const Polygon* polygon = RandomixGenerators::GetContext(GetAMX()).polygons.get(handle);
+    if (!polygon) return false;
+    
+    cell* xAddr = GetArrayPtr(GetAMX(), outX);
+    cell* yAddr = GetArrayPtr(GetAMX(), outY);
+    if (!xAddr || !yAddr) return false;
+    
+    RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        polygon->sample(rng, *reinterpret_cast<float*>(xAddr), *reinterpret_cast<float*>(yAddr));
+    });
+    return true;
+}
+
+/**
+ * Fill x[] and y[] with random points in a cached polygon
+ */
+SCRIPT_API(PRandPolygonPoints, bool(int handle, cell xAddr, cell yAddr, int count)) {
+    if (count <= 0) return false;
+    
+    const Polygon* polygon = RandomixGenerators::GetContext(GetAMX()).polygons.get(handle);
+    if (!polygon) return false;
+    
+    cell* outX = GetArrayPtr(GetAMX(), xAddr);
+    cell* outY = GetArrayPtr(GetAMX(), yAddr);
+    if (!outX || !outY) return false;
+    
+    float* xs = reinterpret_cast<float*>(outX);
+    float* ys = reinterpret_cast<float*>(outY);
+    RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        for (int i = 0; i < count; i++) {
+            polygon->sample(rng, xs[i], ys[i]);
+        }
+    });
+    return true;
+}
+
+/**
+ * Area of a cached polygon with its holes removed, 0.0 for an invalid handle
+ */
+SCRIPT_API(PRandPolygonArea, float(int handle)) {
+    const Polygon* polygon = RandomixGenerators::GetContext(GetAMX()).polygons.get(handle);
+    return polygon ? static_cast<float>(polygon->area()) : 0.0f;
+}
+
+/**
+ * Destroy a cached polygon (also freed when the script unloads)
+ */
+SCRIPT_API(PRandPolygonDestroy, bool(int handle)) {
+    return RandomixGenerators::GetContext(GetAMX()).polygons.remove(handle);
+}
+
+// ============================================
+// POISSON-DISC FUNCTIONS
+// ============================================
+
+/**
+ * Fill x[] and y[] with up to maxPoints points in a rectangle, no two closer
+ * than minDistance; returns how many fit
+ */
+SCRIPT_API(PRandPoissonRect, int(float minX, float minY, float maxX, float maxY, float minDistance, cell xAddr, cell yAddr, int maxPoints)) {
+    if (maxPoints <= 0 || minDistance <= 0.0f) return 0;
+    
+    cell* outX = GetArrayPtr(GetAMX(), xAddr);
+    cell* outY = GetArrayPtr(GetAMX(), yAddr);
+    if (!outX || !outY) return 0;
+    
+    RandomixPoisson::Rect region = { std::min(minX, maxX), std::min(minY, maxY), std::max(minX, maxX), std::max(minY, maxY) };
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        return static_cast<int>(RandomixPoisson::fill(rng, region, minDistance,
+            reinterpret_cast<float*>(outX), reinterpret_cast<float*>(outY), static_cast<size_t>(maxPoints)));
+    });
+}
+
+/**
+ * Fill x[] and y[] with up to maxPoints points in a circle, no two closer
+ * than minDistance; returns how many fit
+ */
+SCRIPT_API(PRandPoissonCircle, int(float centerX, float centerY, float radius, float minDistance, cell xAddr, cell yAddr, int maxPoints)) {
+    if (maxPoints <= 0 || minDistance <= 0.0f || radius <= 0.0f) return 0;
+    
+    cell* outX = GetArrayPtr(GetAMX(), xAddr);
+    cell* outY = GetArrayPtr(GetAMX(), yAddr);
+    if (!outX || !outY) return 0;
+    
+    RandomixPoisson::Disc region = { centerX, centerY, radius };
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        return static_cast<int>(RandomixPoisson::fill(rng, region, minDistance,
+            reinterpret_cast<float*>(outX), reinterpret_cast<float*>(outY), static_cast<size_t>(maxPoints)));
+    });
+}
+
+/**
+ * Fill x[] and y[] with up to maxPoints points in a cached polygon (holes
+ * stay empty), no two closer than minDistance; returns how many fit
+ */
+SCRIPT_API(PRandPoissonPolygon, int(int handle, float minDistance, cell xAddr, cell yAddr, int maxPoints)) {
+    if (maxPoints <= 0 || minDistance <= 0.0f) return 0;
+    
+    const Polygon* polygon = RandomixGenerators::GetContext(GetAMX()).polygons.get(handle);
+    if (!polygon) return 0;
+    
+    cell* outX = GetArrayPtr(GetAMX(), xAddr);
+    cell* outY = GetArrayPtr(GetAMX(), yAddr);
+    if (!outX || !outY) return 0;
+    
+    return RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        return static_cast<int>(RandomixPoisson::fill(rng, *polygon, minDistance,
+            reinterpret_cast<float*>(outX), reinterpret_cast<float*>(outY), static_cast<size_t>(maxPoints)));
+    });
+}
+
+// ============================================
+// POLYLINE FUNCTIONS
+// ============================================
+
+/**
+ * Precompute a path (x,y pairs or x,y,z triples) for sampling by arc length,
+ * 0 if it has no length or more than Polyline::MAX_POINTS points
+ */
+SCRIPT_API(PRandPolylineCreate, int(cell pointsAddr, int pointCount, bool is3D, bool closed)) {
+    if (pointCount < 2) return 0;
+    
+    cell* pointsPtr = GetArrayPtr(GetAMX(), pointsAddr);
+    if (!pointsPtr) return 0;
+    
+    std::unique_ptr<Polyline> line(new Polyline(is3D ? 3 : 2));
+    if (!line->append(reinterpret_cast<float*>(pointsPtr), static_cast<size_t>(pointCount), closed)) return 0;
+    
+    return RandomixGenerators::GetContext(GetAMX()).polylines.add(std::move(line));
+}
+
+/**
+ * Add another path (e.g. the next road of a network) to a polyline
+ */
+SCRIPT_API(PRandPolylineAppend, bool(int handle, cell pointsAddr, int pointCount, bool closed)) {
+    Polyline* line = RandomixGenerators::GetContext(GetAMX()).polylines.get(handle);
+    if (!line || pointCount < 2) return false;
+    
+    cell* pointsPtr = GetArrayPtr(GetAMX(), pointsAddr);
+    if (!pointsPtr) return false;
+    
+    return line->append(reinterpret_cast<float*>(pointsPtr), static_cast<size_t>(pointCount), closed);
+}
+
+/**
+ * Generate random point along a polyline, uniform by length, pushed
+ * sideways by up to jitter
+ */
+SCRIPT_API(PRandPolylinePoint, bool(int handle, cell outX, cell outY, cell outZ, float jitter)) {
+    const Polyline* line = RandomixGenerators::GetContext(GetAMX()).polylines.get(handle);
+    if (!line) return false;
+    
+    cell* xAddr = GetArrayPtr(GetAMX(), outX);
+    cell* yAddr = GetArrayPtr(GetAMX(), outY);
+    cell* zAddr = GetArrayPtr(GetAMX(), outZ);
+    if (!xAddr || !yAddr || !zAddr) return false;
+    
+    RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        line->sample(rng, jitter, *reinterpret_cast<float*>(xAddr), *reinterpret_cast<float*>(yAddr),
+            *reinterpret_cast<float*>(zAddr));
+    });
+    return true;
+}
+
+/**
+ * Fill x[], y[] and z[] with random points along a polyline
+ */
+SCRIPT_API(PRandPolylinePoints, bool(int handle, cell xAddr, cell yAddr, cell zAddr, int count, float jitter)) {
+    if (count <= 0) return false;
+    
+    const Polyline* line = RandomixGenerators::GetContext(GetAMX()).polylines.get(handle);
+    if (!line) return false;
+    
+    cell* outX = GetArrayPtr(GetAMX(), xAddr);
+    cell* outY = GetArrayPtr(GetAMX(), yAddr);
+    cell* outZ = GetArrayPtr(GetAMX(), zAddr);
+    if (!outX || !outY || !outZ) return false;
+    
+    float* xs = reinterpret_cast<float*>(outX);
+    float* ys = reinterpret_cast<float*>(outY);
+    float* zs = reinterpret_cast<float*>(outZ);
+    RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        for (int i = 0; i < count; i++) {
+            line->sample(rng, jitter, xs[i], ys[i], zs[i]);
+        }
+    });
+    return true;
+}
+
+/**
+ * Point at a distance along a polyline, clamped to its length
+ */
+SCRIPT_API(PRandPolylineAt, bool(int handle, float distance, cell outX, cell outY, cell outZ)) {
+    const Polyline* line = RandomixGenerators::GetContext(GetAMX()).polylines.get(handle);
+    if (!line) return false;
+    
+    cell* xAddr = GetArrayPtr(GetAMX(), outX);
+    cell* yAddr = GetArrayPtr(GetAMX(), outY);
+    cell* zAddr = GetArrayPtr(GetAMX(), outZ);
+    if (!xAddr || !yAddr || !zAddr) return false;
+    
+    line->at(distance, *reinterpret_cast<float*>(xAddr), *reinterpret_cast<float*>(yAddr),
+        *reinterpret_cast<float*>(zAddr));
+    return true;
+}
+
+/**
+ * Total length of a polyline, 0.0 for an invalid handle
+ */
+SCRIPT_API(PRandPolylineLength, float(int handle)) {
+    const Polyline* line = RandomixGenerators::GetContext(GetAMX()).polylines.get(handle);
+    return line ? static_cast<float>(line->length()) : 0.0f;
+}
+
+/**
+ * Destroy a polyline (also freed when the script unloads)
+ */
+SCRIPT_API(PRandPolylineDestroy, bool(int handle)) {
+    return RandomixGenerators::GetContext(GetAMX()).polylines.remove(handle);
+}
+
+// ============================================
+// ZONE SET FUNCTIONS
+// ============================================
+
+static bool AddZone(AMX* amx, int handle, const RandomixZones::Zone& zone) {
+    ZoneSet* set = RandomixGenerators::GetContext(amx).zone_sets.get(handle);
+    return set && set->add(zone);
+}
+
+/**
+ * Create an empty zone set, sampled uniformly over the union of its shapes
+ */
+SCRIPT_API(PRandZoneSetCreate, int()) {
+    return RandomixGenerators::GetContext(GetAMX()).zone_sets.add(std::unique_ptr<ZoneSet>(new ZoneSet()));
+}
+
+/**
+ * Add an axis-aligned box to a zone set
+ */
+SCRIPT_API(PRandZoneSetAddBox, bool(int handle, float minX, float minY, float minZ, float maxX, float maxY, float maxZ)) {
+    return AddZone(GetAMX(), handle, RandomixZones::Box{ std::min(minX, maxX), std::min(minY, maxY), std::min(minZ, maxZ),
+        std::max(minX, maxX), std::max(minY, maxY), std::max(minZ, maxZ) });
+}
+
+/**
+ * Add a box rotated about Z (degrees) around its centre to a zone set
+ */
+SCRIPT_API(PRandZoneSetAddOrientedBox, bool(int handle, float centerX, float centerY, float centerZ, float sizeX, float sizeY, float sizeZ, float rotZ)) {
+    float angle = rotZ * 0.01745329252f;
+    return AddZone(GetAMX(), handle, RandomixZones::OrientedBox{ centerX, centerY, centerZ,
+        std::fabs(sizeX) * 0.5f, std::fabs(sizeY) * 0.5f, std::fabs(sizeZ) * 0.5f, std::cos(angle), std::sin(angle) });
+}
+
+/**
+ * Add a sphere to a zone set
+ */
+SCRIPT_API(PRandZoneSetAddSphere, bool(int handle, float centerX, float centerY, float centerZ, float radius)) {
+    if (radius <= 0.0f) return false;
+    return AddZone(GetAMX(), handle, RandomixZones::Sphere{ centerX, centerY, centerZ, radius });
+}
+
+/**
+ * Add an upright cylinder, standing on its base centre, to a zone set
+ */
+SCRIPT_API(PRandZoneSetAddCylinder, bool(int handle, float baseX, float baseY, float baseZ, float radius, float height)) {
+    if (radius <= 0.0f || height <= 0.0f) return false;
+    return AddZone(GetAMX(), handle, RandomixZones::Cylinder{ baseX, baseY, baseZ, radius, height });
+}
+
+/**
+ * Add a capsule (all points within radius of a segment) to a zone set
+ */
+SCRIPT_API(PRandZoneSetAddCapsule, bool(int handle, float x1, float y1, float z1, float x2, float y2, float z2, float radius)) {
+    if (radius <= 0.0f) return false;
+    return AddZone(GetAMX(), handle, RandomixZones::Capsule(x1, y1, z1, x2, y2, z2, radius));
+}
+
+/**
+ * Generate random point uniformly over a zone set
+ */
+SCRIPT_API(PRandZoneSetPoint, bool(int handle, cell outX, cell outY, cell outZ)) {
+    const ZoneSet* set = RandomixGenerators::GetContext(GetAMX()).zone_sets.get(handle);
+    if (!set || set->size() == 0) return false;
+    
+    cell* xAddr = GetArrayPtr(GetAMX(), outX);
+    cell* yAddr = GetArrayPtr(GetAMX(), outY);
+    cell* zAddr = GetArrayPtr(GetAMX(), outZ);
+    if (!xAddr || !yAddr || !zAddr) return false;
+    
+    RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        set->sample(rng, *reinterpret_cast<float*>(xAddr), *reinterpret_cast<float*>(yAddr),
+            *reinterpret_cast<float*>(zAddr));
+    });
+    return true;
+}
+
+/**
+ * Fill x[], y[] and z[] with random points uniformly over a zone set
+ */
+SCRIPT_API(PRandZoneSetPoints, bool(int handle, cell xAddr, cell yAddr, cell zAddr, int count)) {
+    if (count <= 0) return false;
+    
+    const ZoneSet* set = RandomixGenerators::GetContext(GetAMX()).zone_sets.get(handle);
+    if (!set || set->size() == 0) return false;
+    
+    cell* outX = GetArrayPtr(GetAMX(), xAddr);
+    cell* outY = GetArrayPtr(GetAMX(), yAddr);
+    cell* outZ = GetArrayPtr(GetAMX(), zAddr);
+    if (!outX || !outY || !outZ) return false;
+    
+    float* xs = reinterpret_cast<float*>(outX);
+    float* ys = reinterpret_cast<float*>(outY);
+    float* zs = reinterpret_cast<float*>(outZ);
+    RandomixGenerators::VisitPRNG(GetAMX(), [&](auto& rng) {
+        for (int i = 0; i < count; i++) {
+            set->sample(rng, xs[i], ys[i], zs[i]);
+        }
+    });
+    return true;
+}
+
+/**
+ * Check whether a point lies in any shape of a zone set
+ */
+SCRIPT_API(PRandZoneSetContains, bool(int handle, float x, float y, float z)) {
+    const ZoneSet* set = RandomixGenerators::GetContext(GetAMX()).zone_sets.get(handle);
+    return set && set->contains(x, y, z);
+}
+
+/**
+ * Destroy a zone set (also freed when the script unloads)
+ */
+SCRIPT_API(PRandZoneSetDestroy, bool(int handle)) {
+    return RandomixGenerators::GetContext(GetAMX()).zone_sets.remove(handle);
+}
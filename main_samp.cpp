@@ -10,7 +10,11 @@
 #include "randomix.hpp"
 #include <chrono>
 #include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
 #include <mutex>
+#include <string>
 #include <vector>
 
 // Plugin data
@@ -35,9 +39,16 @@ PLUGIN_EXPORT bool PLUGIN_CALL Load(void** ppData) {
     RandomixGenerators::SeedPRNG(seed);
     RandomixGenerators::SeedCSPRNG(seed);
     
+    // Default PRNG engine for scripts, e.g. RANDOMIX_ENGINE=wyrand
+    EngineKind engine;
+    if (RandomixGenerators::ParseEngineName(std::getenv("RANDOMIX_ENGINE"), engine)) {
+        RandomixGenerators::SetDefaultEngine(engine);
+    }
+    
     logprintf("");
     logprintf("  Randomix Plugin Loaded");
     logprintf("  Version: v%s", RANDOMIX_VERSION);
+    logprintf("  Engine: %s", RandomixGenerators::EngineName(RandomixGenerators::GetDefaultEngine()));
     logprintf("  Author: Fanorisky");
     logprintf("  GitHub: github.com/Fanorisky/PawnRandomix");
     logprintf("");
@@ -65,8 +76,9 @@ static cell AMX_NATIVE_CALL n_PRandRange(AMX* amx, cell* params) {
     if (min == max) return min;
     
     uint32_t range = static_cast<uint32_t>(max - min);
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
-    return min + static_cast<cell>(RandomixGenerators::GetPRNG().next_bounded(range + 1));
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        return min + static_cast<cell>(rng.next_bounded(range + 1));
+    });
 }
 
 // native CSPRandRange(min, max);
@@ -78,8 +90,9 @@ static cell AMX_NATIVE_CALL n_CSPRandRange(AMX* amx, cell* params) {
     if (min == max) return min;
     
     uint32_t range = static_cast<uint32_t>(max - min);
-    std::lock_guard<std::mutex> lock(RandomixGenerators::csprng_mutex);
-    return min + static_cast<cell>(RandomixGenerators::GetCSPRNG().next_bounded(range + 1));
+    return RandomixGenerators::VisitCSPRNG(amx, [&](auto& rng) {
+        return min + static_cast<cell>(rng.next_bounded(range + 1));
+    });
 }
 
 // native Float:PRandFloatRange(Float:min, Float:max);
@@ -90,9 +103,10 @@ static cell AMX_NATIVE_CALL n_PRandFloatRange(AMX* amx, cell* params) {
     if (min > max) std::swap(min, max);
     if (min == max) return params[1];
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
-    float result = min + RandomixGenerators::GetPRNG().next_float() * (max - min);
-    return amx_ftoc(result);
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        float result = min + rng.next_float() * (max - min);
+        return amx_ftoc(result);
+    });
 }
 
 // native Float:CSPRandFloatRange(Float:min, Float:max);
@@ -103,23 +117,86 @@ static cell AMX_NATIVE_CALL n_CSPRandFloatRange(AMX* amx, cell* params) {
     if (min > max) std::swap(min, max);
     if (min == max) return params[1];
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::csprng_mutex);
-    float result = min + RandomixGenerators::GetCSPRNG().next_float() * (max - min);
-    return amx_ftoc(result);
+    return RandomixGenerators::VisitCSPRNG(amx, [&](auto& rng) {
+        float result = min + rng.next_float() * (max - min);
+        return amx_ftoc(result);
+    });
 }
 
 // native SeedPRNG(seed);
 static cell AMX_NATIVE_CALL n_SeedPRNG(AMX* amx, cell* params) {
-    RandomixGenerators::SeedPRNG(static_cast<uint64_t>(params[1]));
+    RandomixGenerators::GetContext(amx).seed(static_cast<uint64_t>(params[1]));
+    return 1;
+}
+
+// native SeedPRNGStream(seed, stream);
+static cell AMX_NATIVE_CALL n_SeedPRNGStream(AMX* amx, cell* params) {
+    RandomixGenerators::GetContext(amx).seed(static_cast<uint64_t>(params[1]), static_cast<uint64_t>(params[2]));
+    return 1;
+}
+
+// native bool:PRandAdvance(steps, stepsHi = 0);
+static cell AMX_NATIVE_CALL n_PRandAdvance(AMX* amx, cell* params) {
+    uint64_t delta = (static_cast<uint64_t>(static_cast<uint32_t>(params[2])) << 32) | static_cast<uint32_t>(params[1]);
+    PCG32* pcg = std::get_if<PCG32>(&RandomixGenerators::GetContext(amx).prng);
+    if (!pcg) return 0;
+    
+    pcg->advance(delta);
+    return 1;
+}
+
+// native bool:PRandBackstep(steps, stepsHi = 0);
+static cell AMX_NATIVE_CALL n_PRandBackstep(AMX* amx, cell* params) {
+    uint64_t delta = (static_cast<uint64_t>(static_cast<uint32_t>(params[2])) << 32) | static_cast<uint32_t>(params[1]);
+    PCG32* pcg = std::get_if<PCG32>(&RandomixGenerators::GetContext(amx).prng);
+    if (!pcg) return 0;
+    
+    pcg->backstep(delta);
+    return 1;
+}
+
+// native bool:PRandSetEngine(PRandEngine:engine, seed = 0);
+static cell AMX_NATIVE_CALL n_PRandSetEngine(AMX* amx, cell* params) {
+    int engine = static_cast<int>(params[1]);
+    if (engine < 0 || engine >= static_cast<int>(std::variant_size<PRNGEngine>::value)) return 0;
+    
+    ScriptContext& ctx = RandomixGenerators::GetContext(amx);
+    uint64_t seed = static_cast<uint64_t>(params[2]);
+    if (seed == 0) {
+        seed = std::visit([](auto& rng) { return rng.next_uint64(); }, ctx.prng);
+    }
+    
+    ctx.set_engine(static_cast<EngineKind>(engine), seed);
     return 1;
 }
 
+// native PRandEngine:PRandGetEngine();
+static cell AMX_NATIVE_CALL n_PRandGetEngine(AMX* amx, cell*) {
+    return static_cast<cell>(RandomixGenerators::GetContext(amx).engine());
+}
+
 // native SeedCSPRNG(seed);
 static cell AMX_NATIVE_CALL n_SeedCSPRNG(AMX* amx, cell* params) {
-    RandomixGenerators::SeedCSPRNG(static_cast<uint64_t>(params[1]));
+    RandomixGenerators::VisitCSPRNG(amx, [&](auto& rng) {
+        rng.seed(static_cast<uint64_t>(params[1]));
+    });
+    return 1;
+}
+
+// native bool:CSPRandSetRounds(rounds);
+static cell AMX_NATIVE_CALL n_CSPRandSetRounds(AMX* amx, cell* params) {
+    int rounds = static_cast<int>(params[1]);
+    if (rounds != 8 && rounds != 12 && rounds != 20) return 0;
+    
+    RandomixGenerators::GetContext(amx).csprng_rounds = rounds;
     return 1;
 }
 
+// native CSPRandGetRounds();
+static cell AMX_NATIVE_CALL n_CSPRandGetRounds(AMX* amx, cell*) {
+    return RandomixGenerators::GetContext(amx).csprng_rounds;
+}
+
 // native bool:PRandBool(Float:probability);
 static cell AMX_NATIVE_CALL n_PRandBool(AMX* amx, cell* params) {
     float probability = amx_ctof(params[1]);
@@ -127,8 +204,9 @@ static cell AMX_NATIVE_CALL n_PRandBool(AMX* amx, cell* params) {
     if (probability <= 0.0f) return 0;
     if (probability >= 1.0f) return 1;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
-    return RandomixGenerators::GetPRNG().next_float() < probability ? 1 : 0;
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        return rng.next_float() < probability ? 1 : 0;
+    });
 }
 
 // native bool:CSPRandBool(Float:probability);
@@ -138,8 +216,9 @@ static cell AMX_NATIVE_CALL n_CSPRandBool(AMX* amx, cell* params) {
     if (probability <= 0.0f) return 0;
     if (probability >= 1.0f) return 1;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::csprng_mutex);
-    return RandomixGenerators::GetCSPRNG().next_float() < probability ? 1 : 0;
+    return RandomixGenerators::VisitCSPRNG(amx, [&](auto& rng) {
+        return rng.next_float() < probability ? 1 : 0;
+    });
 }
 
 // native bool:PRandBoolWeighted(trueWeight, falseWeight);
@@ -151,8 +230,9 @@ static cell AMX_NATIVE_CALL n_PRandBoolWeighted(AMX* amx, cell* params) {
     if (falseW <= 0) return 1;
     
     uint32_t total = static_cast<uint32_t>(trueW + falseW);
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
-    return RandomixGenerators::GetPRNG().next_bounded(total) < static_cast<uint32_t>(trueW) ? 1 : 0;
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        return rng.next_bounded(total) < static_cast<uint32_t>(trueW) ? 1 : 0;
+    });
 }
 
 // native PRandWeighted(const weights[], count);
@@ -172,18 +252,19 @@ static cell AMX_NATIVE_CALL n_PRandWeighted(AMX* amx, cell* params) {
     
     if (total == 0) return 0;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
-    uint32_t rand = RandomixGenerators::GetPRNG().next_bounded(total);
-    uint32_t sum = 0;
-    
-    for (int i = 0; i < count; i++) {
-        if (weights[i] > 0) {
-            sum += static_cast<uint32_t>(weights[i]);
-            if (rand < sum) return i;
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        uint32_t rand = rng.next_bounded(total);
+        uint32_t sum = 0;
+        
+        for (int i = 0; i < count; i++) {
+            if (weights[i] > 0) {
+                sum += static_cast<uint32_t>(weights[i]);
+                if (rand < sum) return i;
+            }
         }
-    }
-    
-    return count - 1;
+        
+        return count - 1;
+    });
 }
 
 // native bool:PRandShuffle(array[], count);
@@ -194,14 +275,14 @@ static cell AMX_NATIVE_CALL n_PRandShuffle(AMX* amx, cell* params) {
     cell* array = GetArrayAddress(amx, params[1]);
     if (!array) return 0;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
-    
-    for (int i = count - 1; i > 0; i--) {
-        int j = static_cast<int>(RandomixGenerators::GetPRNG().next_bounded(i + 1));
-        std::swap(array[i], array[j]);
-    }
-    
-    return 1;
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        for (int i = count - 1; i > 0; i--) {
+            int j = static_cast<int>(rng.next_bounded(i + 1));
+            std::swap(array[i], array[j]);
+        }
+        
+        return 1;
+    });
 }
 
 // native bool:PRandShuffleRange(array[], start, end);
@@ -215,13 +296,165 @@ static cell AMX_NATIVE_CALL n_PRandShuffleRange(AMX* amx, cell* params) {
     if (start > end) std::swap(start, end);
     if (end - start < 1) return 1;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        for (int i = end; i > start; i--) {
+            int j = start + rng.next_bounded(i - start + 1);
+            std::swap(array[i], array[j]);
+        }
+        
+        return 1;
+    });
+}
+
+// native PRandWeightedSample(const weights[], dest[], k, count = sizeof weights);
+static cell AMX_NATIVE_CALL n_PRandWeightedSample(AMX* amx, cell* params) {
+    int k = static_cast<int>(params[3]);
+    int count = static_cast<int>(params[4]);
+    if (count <= 0 || k <= 0) return 0;
+    
+    cell* weights = GetArrayAddress(amx, params[1]);
+    cell* dest = GetArrayAddress(amx, params[2]);
+    if (!weights || !dest) return 0;
+    
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        return static_cast<cell>(RandomixSampling::weighted_sample(rng, reinterpret_cast<const int32_t*>(weights),
+            static_cast<size_t>(count), static_cast<size_t>(k), reinterpret_cast<uint32_t*>(dest)));
+    });
+}
+
+// native bool:PRandWeightedShuffle(array[], const weights[], count = sizeof array);
+static cell AMX_NATIVE_CALL n_PRandWeightedShuffle(AMX* amx, cell* params) {
+    int count = static_cast<int>(params[3]);
+    if (count <= 1) return 1;
+    
+    cell* array = GetArrayAddress(amx, params[1]);
+    cell* weights = GetArrayAddress(amx, params[2]);
+    if (!array || !weights) return 0;
+    
+    std::vector<uint32_t> order(static_cast<size_t>(count));
+    RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        RandomixSampling::weighted_order(rng, reinterpret_cast<const int32_t*>(weights), order.size(), order.data());
+    });
+    
+    std::vector<cell> source(array, array + count);
+    for (int i = 0; i < count; i++) {
+        array[i] = source[order[i]];
+    }
+    return 1;
+}
+
+// native PRandSample(dest[], n, k = sizeof dest, bool:sorted = false);
+static cell AMX_NATIVE_CALL n_PRandSample(AMX* amx, cell* params) {
+    int n = static_cast<int>(params[2]);
+    int k = static_cast<int>(params[3]);
+    bool sorted = params[4] != 0;
+    
+    if (n <= 0 || k <= 0) return 0;
+    
+    cell* dest = GetArrayAddress(amx, params[1]);
+    if (!dest) return 0;
+    
+    if (k > n) k = n;
+    
+    RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        RandomixSampling::uniform_sample(rng, static_cast<uint32_t>(n), static_cast<uint32_t>(k),
+            reinterpret_cast<uint32_t*>(dest), sorted);
+    });
+    return k;
+}
+
+// native bool:PRandFill(dest[], count, min, max);
+static cell AMX_NATIVE_CALL n_PRandFill(AMX* amx, cell* params) {
+    int count = static_cast<int>(params[2]);
+    if (count <= 0) return 0;
+    
+    cell* dest = GetArrayAddress(amx, params[1]);
+    if (!dest) return 0;
+    
+    int min = static_cast<int>(params[3]);
+    int max = static_cast<int>(params[4]);
+    if (min > max) std::swap(min, max);
+    
+    uint32_t bound = static_cast<uint32_t>(max - min) + 1;
+    uint32_t* words = reinterpret_cast<uint32_t*>(dest);
+    
+    RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        // bound wraps to 0 for the full 32-bit range
+        if (bound == 0) rng.fill(words, static_cast<size_t>(count));
+        else RandomixDetail::fill_bounded(rng, words, static_cast<size_t>(count), bound);
+    });
+    
+    for (int i = 0; i < count; i++) {
+        dest[i] = min + dest[i];
+    }
+    return 1;
+}
+
+// native bool:PRandFloatFill(Float:dest[], count, Float:min, Float:max);
+static cell AMX_NATIVE_CALL n_PRandFloatFill(AMX* amx, cell* params) {
+    int count = static_cast<int>(params[2]);
+    if (count <= 0) return 0;
+    
+    cell* dest = GetArrayAddress(amx, params[1]);
+    if (!dest) return 0;
+    
+    float min = amx_ctof(params[3]);
+    float max = amx_ctof(params[4]);
+    if (min > max) std::swap(min, max);
+    
+    RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        for (int i = 0; i < count; i++) {
+            float value = min + rng.next_float() * (max - min);
+            dest[i] = amx_ftoc(value);
+        }
+    });
+    return 1;
+}
+
+// native bool:CSPRandFill(dest[], count, min, max);
+static cell AMX_NATIVE_CALL n_CSPRandFill(AMX* amx, cell* params) {
+    int count = static_cast<int>(params[2]);
+    if (count <= 0) return 0;
+    
+    cell* dest = GetArrayAddress(amx, params[1]);
+    if (!dest) return 0;
+    
+    int min = static_cast<int>(params[3]);
+    int max = static_cast<int>(params[4]);
+    if (min > max) std::swap(min, max);
+    
+    uint32_t bound = static_cast<uint32_t>(max - min) + 1;
+    uint32_t* words = reinterpret_cast<uint32_t*>(dest);
+    
+    RandomixGenerators::VisitCSPRNG(amx, [&](auto& rng) {
+        if (bound == 0) rng.fill(words, static_cast<size_t>(count));
+        else RandomixDetail::fill_bounded(rng, words, static_cast<size_t>(count), bound);
+    });
     
-    for (int i = end; i > start; i--) {
-        int j = start + RandomixGenerators::GetPRNG().next_bounded(i - start + 1);
-        std::swap(array[i], array[j]);
+    for (int i = 0; i < count; i++) {
+        dest[i] = min + dest[i];
     }
+    return 1;
+}
+
+// native bool:CSPRandFloatFill(Float:dest[], count, Float:min, Float:max);
+static cell AMX_NATIVE_CALL n_CSPRandFloatFill(AMX* amx, cell* params) {
+    int count = static_cast<int>(params[2]);
+    if (count <= 0) return 0;
+    
+    cell* dest = GetArrayAddress(amx, params[1]);
+    if (!dest) return 0;
+    
+    float min = amx_ctof(params[3]);
+    float max = amx_ctof(params[4]);
+    if (min > max) std::swap(min, max);
     
+    RandomixGenerators::VisitCSPRNG(amx, [&](auto& rng) {
+        for (int i = 0; i < count; i++) {
+            float value = min + rng.next_float() * (max - min);
+            dest[i] = amx_ftoc(value);
+        }
+    });
     return 1;
 }
 
@@ -232,17 +465,82 @@ static cell AMX_NATIVE_CALL n_PRandGaussian(AMX* amx, cell* params) {
     
     if (stddev <= 0.0f) return static_cast<cell>(mean);
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        float result = mean + RandomixNormal::next(rng) * stddev;
+        return static_cast<cell>(result < 0.0f ? 0.0f : result);
+    });
+}
+
+// native Float:PRandGaussianFloat(Float:mean, Float:stddev);
+static cell AMX_NATIVE_CALL n_PRandGaussianFloat(AMX* amx, cell* params) {
+    float mean = amx_ctof(params[1]);
+    float stddev = amx_ctof(params[2]);
+    
+    if (stddev <= 0.0f) return params[1];
+    
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        float result = mean + RandomixNormal::next(rng) * stddev;
+        return amx_ftoc(result);
+    });
+}
+
+// native Float:PRandGaussianClamped(Float:mean, Float:stddev, Float:min, Float:max);
+static cell AMX_NATIVE_CALL n_PRandGaussianClamped(AMX* amx, cell* params) {
+    float mean = amx_ctof(params[1]);
+    float stddev = amx_ctof(params[2]);
+    float min = amx_ctof(params[3]);
+    float max = amx_ctof(params[4]);
+    
+    if (min > max) std::swap(min, max);
+    
+    if (stddev <= 0.0f) {
+        float result = std::min(std::max(mean, min), max);
+        return amx_ftoc(result);
+    }
+    
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        float result = std::min(std::max(mean + RandomixNormal::next(rng) * stddev, min), max);
+        return amx_ftoc(result);
+    });
+}
+
+// native bool:PRandGaussianFill(Float:dest[], count, Float:mean, Float:stddev);
+static cell AMX_NATIVE_CALL n_PRandGaussianFill(AMX* amx, cell* params) {
+    int count = static_cast<int>(params[2]);
+    float mean = amx_ctof(params[3]);
+    float stddev = amx_ctof(params[4]);
+    
+    if (count <= 0 || stddev < 0.0f) return 0;
+    
+    cell* dest = GetArrayAddress(amx, params[1]);
+    if (!dest) return 0;
+    
+    RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        RandomixNormal::fill(rng, reinterpret_cast<uint32_t*>(dest), static_cast<size_t>(count), mean, stddev,
+            -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity());
+    });
+    return 1;
+}
+
+// native bool:PRandGaussianFillClamped(Float:dest[], count, Float:mean, Float:stddev, Float:min, Float:max);
+static cell AMX_NATIVE_CALL n_PRandGaussianFillClamped(AMX* amx, cell* params) {
+    int count = static_cast<int>(params[2]);
+    float mean = amx_ctof(params[3]);
+    float stddev = amx_ctof(params[4]);
+    float min = amx_ctof(params[5]);
+    float max = amx_ctof(params[6]);
     
-    float u1 = RandomixGenerators::GetPRNG().next_float();
-    float u2 = RandomixGenerators::GetPRNG().next_float();
+    if (count <= 0 || stddev < 0.0f) return 0;
     
-    if (u1 < 1e-10f) u1 = 1e-10f;
+    cell* dest = GetArrayAddress(amx, params[1]);
+    if (!dest) return 0;
     
-    float z0 = sqrtf(-2.0f * logf(u1)) * cosf(6.28318530718f * u2);
-    float result = mean + z0 * stddev;
+    if (min > max) std::swap(min, max);
     
-    return static_cast<cell>(result < 0.0f ? 0.0f : result);
+    RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        RandomixNormal::fill(rng, reinterpret_cast<uint32_t*>(dest), static_cast<size_t>(count), mean, stddev, min, max);
+    });
+    return 1;
 }
 
 // native PRandDice(sides, count);
@@ -252,16 +550,9 @@ static cell AMX_NATIVE_CALL n_PRandDice(AMX* amx, cell* params) {
     
     if (sides <= 0 || count <= 0) return 0;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
-    
-    uint32_t total = 0;
-    uint32_t uSides = static_cast<uint32_t>(sides);
-    
-    for (int i = 0; i < count; i++) {
-        total += RandomixGenerators::GetPRNG().next_bounded(uSides) + 1;
-    }
-    
-    return static_cast<cell>(total);
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        return static_cast<cell>(RandomixDice::sum(rng, static_cast<uint32_t>(sides), static_cast<uint64_t>(count)));
+    });
 }
 
 // native CSPRandToken(length);
@@ -269,34 +560,150 @@ static cell AMX_NATIVE_CALL n_CSPRandToken(AMX* amx, cell* params) {
     int length = static_cast<int>(params[1]);
     if (length <= 0) return 0;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::csprng_mutex);
+    return RandomixGenerators::VisitCSPRNG(amx, [&](auto& rng) {
+        uint32_t token = 0;
+        int actualLength = (length > 8) ? 8 : length;
+        
+        for (int i = 0; i < actualLength; i++) {
+            token = (token << 4) | (rng.next_bounded(16));
+        }
+        
+        return static_cast<cell>(token);
+    });
+}
+
+// native bool:CSPRandBytes(dest[], length);
+static cell AMX_NATIVE_CALL n_CSPRandBytes(AMX* amx, cell* params) {
+    int length = static_cast<int>(params[2]);
+    if (length <= 0) return 0;
+    
+    cell* dest = GetArrayAddress(amx, params[1]);
+    if (!dest) return 0;
     
-    uint32_t token = 0;
-    int actualLength = (length > 8) ? 8 : length;
+    // Keystream goes into the front of the array, then widens back to front
+    uint8_t* bytes = reinterpret_cast<uint8_t*>(dest);
+    RandomixGenerators::VisitCSPRNG(amx, [&](auto& rng) {
+        rng.next_bytes(bytes, static_cast<size_t>(length));
+    });
     
-    for (int i = 0; i < actualLength; i++) {
-        token = (token << 4) | (RandomixGenerators::GetCSPRNG().next_bounded(16));
+    for (int i = length - 1; i >= 0; i--) {
+        dest[i] = static_cast<cell>(bytes[i]);
     }
     
-    return static_cast<cell>(token);
+    return 1;
 }
 
-// native bool:CSPRandBytes(dest[], length);
-static cell AMX_NATIVE_CALL n_CSPRandBytes(AMX* amx, cell* params) {
+// Store bytes as a Pawn packed array (dest{i} is byte i, first byte in the
+// high end of each cell, unused tail bytes zeroed). Safe when bytes aliases dest.
+static void PackBytes(cell* dest, const uint8_t* bytes, size_t length) {
+    for (size_t i = 0; i < length; i += 4) {
+        uint32_t word = 0;
+        for (size_t j = 0; j < 4; j++) {
+            word = (word << 8) | (i + j < length ? bytes[i + j] : 0u);
+        }
+        dest[i / 4] = static_cast<cell>(word);
+    }
+}
+
+// Packed string with terminator, needs length / 4 + 1 cells
+static void PackString(cell* dest, const std::string& text) {
+    PackBytes(dest, reinterpret_cast<const uint8_t*>(text.data()), text.size());
+    if (text.size() % 4 == 0) {
+        dest[text.size() / 4] = 0;
+    }
+}
+
+static std::string EncodeHex(const uint8_t* bytes, size_t length) {
+    static const char* hex = "0123456789abcdef";
+    std::string text;
+    text.reserve(length * 2);
+    
+    for (size_t i = 0; i < length; i++) {
+        text += hex[bytes[i] >> 4];
+        text += hex[bytes[i] & 0xF];
+    }
+    return text;
+}
+
+// RFC 4648 base64, or the URL-safe alphabet without padding
+static std::string EncodeBase64(const uint8_t* bytes, size_t length, bool urlSafe) {
+    const char* alphabet = urlSafe
+        ? "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_"
+        : "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string text;
+    text.reserve((length + 2) / 3 * 4);
+    
+    for (size_t i = 0; i < length; i += 3) {
+        uint32_t group = static_cast<uint32_t>(bytes[i]) << 16;
+        if (i + 1 < length) group |= static_cast<uint32_t>(bytes[i + 1]) << 8;
+        if (i + 2 < length) group |= bytes[i + 2];
+        
+        size_t chars = std::min<size_t>(length - i, 3) + 1;
+        for (size_t j = 0; j < 4; j++) {
+            if (j < chars) text += alphabet[(group >> (18 - 6 * j)) & 0x3F];
+            else if (!urlSafe) text += '=';
+        }
+    }
+    return text;
+}
+
+// native bool:CSPRandBytesPacked(dest[], length);
+static cell AMX_NATIVE_CALL n_CSPRandBytesPacked(AMX* amx, cell* params) {
     int length = static_cast<int>(params[2]);
     if (length <= 0) return 0;
     
     cell* dest = GetArrayAddress(amx, params[1]);
     if (!dest) return 0;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::csprng_mutex);
+    uint8_t* bytes = reinterpret_cast<uint8_t*>(dest);
+    RandomixGenerators::VisitCSPRNG(amx, [&](auto& rng) {
+        rng.next_bytes(bytes, static_cast<size_t>(length));
+    });
     
-    for (int i = 0; i < length; i++) {
-        dest[i] = static_cast<cell>(
-            RandomixGenerators::GetCSPRNG().next_uint32() & 0xFF
-        );
-    }
+    PackBytes(dest, bytes, static_cast<size_t>(length));
+    return 1;
+}
+
+// native bool:CSPRandHex(dest[], bytes, size = sizeof dest);
+static cell AMX_NATIVE_CALL n_CSPRandHex(AMX* amx, cell* params) {
+    int bytes = static_cast<int>(params[2]);
+    int size = static_cast<int>(params[3]);
+    
+    if (bytes <= 0 || size <= 0) return 0;
+    if (static_cast<int64_t>(bytes) * 2 / 4 + 1 > size) return 0;
+    
+    cell* dest = GetArrayAddress(amx, params[1]);
+    if (!dest) return 0;
+    
+    std::vector<uint8_t> raw(static_cast<size_t>(bytes));
+    RandomixGenerators::VisitCSPRNG(amx, [&](auto& rng) {
+        rng.next_bytes(raw.data(), raw.size());
+    });
+    
+    PackString(dest, EncodeHex(raw.data(), raw.size()));
+    return 1;
+}
+
+// native bool:CSPRandBase64(dest[], bytes, bool:urlSafe = false, size = sizeof dest);
+static cell AMX_NATIVE_CALL n_CSPRandBase64(AMX* amx, cell* params) {
+    int bytes = static_cast<int>(params[2]);
+    bool urlSafe = params[3] != 0;
+    int size = static_cast<int>(params[4]);
+    
+    if (bytes <= 0 || size <= 0) return 0;
+    
+    int64_t chars = urlSafe ? (static_cast<int64_t>(bytes) * 4 + 2) / 3 : (static_cast<int64_t>(bytes) + 2) / 3 * 4;
+    if (chars / 4 + 1 > size) return 0;
     
+    cell* dest = GetArrayAddress(amx, params[1]);
+    if (!dest) return 0;
+    
+    std::vector<uint8_t> raw(static_cast<size_t>(bytes));
+    RandomixGenerators::VisitCSPRNG(amx, [&](auto& rng) {
+        rng.next_bytes(raw.data(), raw.size());
+    });
+    
+    PackString(dest, EncodeBase64(raw.data(), raw.size(), urlSafe));
     return 1;
 }
 
@@ -306,10 +713,9 @@ static cell AMX_NATIVE_CALL n_CSPRandUUID(AMX* amx, cell* params) {
     if (!out) return 0;
     
     uint8_t bytes[16];
-    {
-        std::lock_guard<std::mutex> lock(RandomixGenerators::csprng_mutex);
-        RandomixGenerators::GetCSPRNG().next_bytes(bytes, 16);
-    }
+    RandomixGenerators::VisitCSPRNG(amx, [&](auto& rng) {
+        rng.next_bytes(bytes, 16);
+    });
     
     bytes[6] = (bytes[6] & 0x0F) | 0x40;
     bytes[8] = (bytes[8] & 0x3F) | 0x80;
@@ -333,92 +739,256 @@ static cell AMX_NATIVE_CALL n_CSPRandUUID(AMX* amx, cell* params) {
 }
 
 // ============================================================================
-// NEW 2D POINT FUNCTIONS (DARI OPEN.MP) - FIXED VERSION
+// 64-BIT FUNCTIONS (PCG64-DXSM)
 // ============================================================================
 
-// native bool:PRandPointInCircle(Float:centerX, Float:centerY, Float:radius, &Float:outX, &Float:outY);
-static cell AMX_NATIVE_CALL n_PRandPointInCircle(AMX* amx, cell* params) {
-    float centerX = amx_ctof(params[1]);
-    float centerY = amx_ctof(params[2]);
-    float radius = amx_ctof(params[3]);
-    
-    if (radius <= 0.0f) return 0;
-    
-    cell *outX, *outY;
-    amx_GetAddr(amx, params[4], &outX);
-    amx_GetAddr(amx, params[5], &outY);
-    
-    if (!outX || !outY) return 0;
-    
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
-    
-    float angle = RandomixGenerators::GetPRNG().next_float() * 6.28318530718f;
-    float r = radius * sqrtf(RandomixGenerators::GetPRNG().next_float());
+static inline void Split64(uint64_t value, cell* hi, cell* lo) {
+    *hi = static_cast<cell>(static_cast<uint32_t>(value >> 32));
+    *lo = static_cast<cell>(static_cast<uint32_t>(value));
+}
+
+// native bool:PRand64(&hi, &lo);
+static cell AMX_NATIVE_CALL n_PRand64(AMX* amx, cell* params) {
+    cell *outHi, *outLo;
+    amx_GetAddr(amx, params[1], &outHi);
+    amx_GetAddr(amx, params[2], &outLo);
     
-    // FIXED: Store in temporary float first
-    float resultX = centerX + r * cosf(angle);
-    float resultY = centerY + r * sinf(angle);
-    *outX = amx_ftoc(resultX);
-    *outY = amx_ftoc(resultY);
+    if (!outHi || !outLo) return 0;
     
+    Split64(RandomixGenerators::GetContext(amx).prng64.next_uint64(), outHi, outLo);
     return 1;
 }
 
-// native bool:CSPRandPointInCircle(Float:centerX, Float:centerY, Float:radius, &Float:outX, &Float:outY);
-static cell AMX_NATIVE_CALL n_CSPRandPointInCircle(AMX* amx, cell* params) {
-    float centerX = amx_ctof(params[1]);
-    float centerY = amx_ctof(params[2]);
-    float radius = amx_ctof(params[3]);
-    
-    if (radius <= 0.0f) return 0;
-    
-    cell *outX, *outY;
-    amx_GetAddr(amx, params[4], &outX);
-    amx_GetAddr(amx, params[5], &outY);
-    
-    if (!outX || !outY) return 0;
+// native bool:PRandBounded64(boundHi, boundLo, &hi, &lo);
+static cell AMX_NATIVE_CALL n_PRandBounded64(AMX* amx, cell* params) {
+    uint64_t bound = (static_cast<uint64_t>(static_cast<uint32_t>(params[1])) << 32) | static_cast<uint32_t>(params[2]);
+    if (bound == 0) return 0;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::csprng_mutex);
+    cell *outHi, *outLo;
+    amx_GetAddr(amx, params[3], &outHi);
+    amx_GetAddr(amx, params[4], &outLo);
     
-    float angle = RandomixGenerators::GetCSPRNG().next_float() * 6.28318530718f;
-    float r = radius * sqrtf(RandomixGenerators::GetCSPRNG().next_float());
-    
-    // FIXED
-    float resultX = centerX + r * cosf(angle);
-    float resultY = centerY + r * sinf(angle);
-    *outX = amx_ftoc(resultX);
-    *outY = amx_ftoc(resultY);
+    if (!outHi || !outLo) return 0;
     
+    Split64(RandomixGenerators::GetContext(amx).prng64.next_bounded64(bound), outHi, outLo);
     return 1;
 }
 
-// native bool:PRandPointOnCircle(Float:centerX, Float:centerY, Float:radius, &Float:outX, &Float:outY);
-static cell AMX_NATIVE_CALL n_PRandPointOnCircle(AMX* amx, cell* params) {
-    float centerX = amx_ctof(params[1]);
-    float centerY = amx_ctof(params[2]);
-    float radius = amx_ctof(params[3]);
+// native bool:PRand64Fill(dest[], count);
+static cell AMX_NATIVE_CALL n_PRand64Fill(AMX* amx, cell* params) {
+    int count = static_cast<int>(params[2]);
+    if (count <= 0) return 0;
     
-    if (radius <= 0.0f) return 0;
+    cell* dest = GetArrayAddress(amx, params[1]);
+    if (!dest) return 0;
     
-    cell *outX, *outY;
-    amx_GetAddr(amx, params[4], &outX);
-    amx_GetAddr(amx, params[5], &outY);
+    PCG64& rng = RandomixGenerators::GetContext(amx).prng64;
     
-    if (!outX || !outY) return 0;
+    for (int i = 0; i < count; i++) {
+        Split64(rng.next_uint64(), dest + i * 2, dest + i * 2 + 1);
+    }
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
+    return 1;
+}
+
+// native bool:PRandDouble(&hi, &lo);
+static cell AMX_NATIVE_CALL n_PRandDouble(AMX* amx, cell* params) {
+    cell *outHi, *outLo;
+    amx_GetAddr(amx, params[1], &outHi);
+    amx_GetAddr(amx, params[2], &outLo);
     
-    float angle = RandomixGenerators::GetPRNG().next_float() * 6.28318530718f;
+    if (!outHi || !outLo) return 0;
     
-    // FIXED
-    float resultX = centerX + radius * cosf(angle);
-    float resultY = centerY + radius * sinf(angle);
-    *outX = amx_ftoc(resultX);
-    *outY = amx_ftoc(resultY);
+    double value = RandomixGenerators::GetContext(amx).prng64.next_double();
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
     
+    Split64(bits, outHi, outLo);
     return 1;
 }
 
+// ============================================================================
+// KEYED FUNCTIONS (PHILOX4X32-10, STATELESS)
+// ============================================================================
+
+static inline uint64_t Join64(cell hi, cell lo) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(hi)) << 32) | static_cast<uint32_t>(lo);
+}
+
+// native PRandKeyed(key, counter, keyHi = 0, counterHi = 0);
+static cell AMX_NATIVE_CALL n_PRandKeyed(AMX*, cell* params) {
+    return static_cast<cell>(Philox4x32::word(Join64(params[3], params[1]), Join64(params[4], params[2]), 0));
+}
+
+// native PRandKeyedRange(min, max, key, counter, keyHi = 0, counterHi = 0);
+static cell AMX_NATIVE_CALL n_PRandKeyedRange(AMX*, cell* params) {
+    int min = static_cast<int>(params[1]);
+    int max = static_cast<int>(params[2]);
+    
+    if (min > max) std::swap(min, max);
+    if (min == max) return min;
+    
+    uint32_t range = static_cast<uint32_t>(max - min);
+    uint64_t key = Join64(params[5], params[3]);
+    uint64_t counter = Join64(params[6], params[4]);
+    
+    // Full int range: range + 1 would wrap to 0, every word is already in range
+    if (range == UINT32_MAX) return min + static_cast<cell>(Philox4x32::word(key, counter, 0));
+    return min + static_cast<cell>(Philox4x32::bounded(key, counter, 0, range + 1));
+}
+
+// native Float:PRandKeyedFloat(key, counter, keyHi = 0, counterHi = 0);
+static cell AMX_NATIVE_CALL n_PRandKeyedFloat(AMX*, cell* params) {
+    float result = Philox4x32::word_float(Join64(params[3], params[1]), Join64(params[4], params[2]), 0);
+    return amx_ftoc(result);
+}
+
+// native bool:PRandKeyedFill(dest[], count, key, counter, keyHi = 0, counterHi = 0);
+static cell AMX_NATIVE_CALL n_PRandKeyedFill(AMX* amx, cell* params) {
+    int count = static_cast<int>(params[2]);
+    if (count <= 0) return 0;
+    
+    cell* dest = GetArrayAddress(amx, params[1]);
+    if (!dest) return 0;
+    
+    Philox4x32::fill(reinterpret_cast<uint32_t*>(dest), static_cast<size_t>(count),
+        Join64(params[5], params[3]), Join64(params[6], params[4]));
+    return 1;
+}
+
+// native bool:PRandKeyedRangeFill(dest[], count, min, max, key, counter, keyHi = 0, counterHi = 0);
+static cell AMX_NATIVE_CALL n_PRandKeyedRangeFill(AMX* amx, cell* params) {
+    int count = static_cast<int>(params[2]);
+    if (count <= 0) return 0;
+    
+    cell* dest = GetArrayAddress(amx, params[1]);
+    if (!dest) return 0;
+    
+    int min = static_cast<int>(params[3]);
+    int max = static_cast<int>(params[4]);
+    if (min > max) std::swap(min, max);
+    uint32_t range = static_cast<uint32_t>(max - min);
+    uint64_t key = Join64(params[7], params[5]);
+    uint64_t counter = Join64(params[8], params[6]);
+    
+    // Full int range: range + 1 would wrap to 0, so take raw words
+    if (range == UINT32_MAX) {
+        Philox4x32::fill(reinterpret_cast<uint32_t*>(dest), static_cast<size_t>(count), key, counter);
+    } else {
+        Philox4x32::fill_bounded(reinterpret_cast<uint32_t*>(dest), static_cast<size_t>(count), key, counter, range + 1);
+    }
+    
+    for (int i = 0; i < count; i++) {
+        dest[i] = min + dest[i];
+    }
+    return 1;
+}
+
+// native bool:PRandKeyedFloatFill(Float:dest[], count, key, counter, keyHi = 0, counterHi = 0);
+static cell AMX_NATIVE_CALL n_PRandKeyedFloatFill(AMX* amx, cell* params) {
+    int count = static_cast<int>(params[2]);
+    if (count <= 0) return 0;
+    
+    cell* dest = GetArrayAddress(amx, params[1]);
+    if (!dest) return 0;
+    
+    uint32_t* words = reinterpret_cast<uint32_t*>(dest);
+    Philox4x32::fill(words, static_cast<size_t>(count), Join64(params[5], params[3]), Join64(params[6], params[4]));
+    
+    for (int i = 0; i < count; i++) {
+        float value = static_cast<float>(words[i] >> 8) / 16777216.0f;
+        dest[i] = amx_ftoc(value);
+    }
+    return 1;
+}
+
+// ============================================================================
+// NEW 2D POINT FUNCTIONS (DARI OPEN.MP) - FIXED VERSION
+// ============================================================================
+
+// native bool:PRandPointInCircle(Float:centerX, Float:centerY, Float:radius, &Float:outX, &Float:outY);
+static cell AMX_NATIVE_CALL n_PRandPointInCircle(AMX* amx, cell* params) {
+    float centerX = amx_ctof(params[1]);
+    float centerY = amx_ctof(params[2]);
+    float radius = amx_ctof(params[3]);
+    
+    if (radius <= 0.0f) return 0;
+    
+    cell *outX, *outY;
+    amx_GetAddr(amx, params[4], &outX);
+    amx_GetAddr(amx, params[5], &outY);
+    
+    if (!outX || !outY) return 0;
+    
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        float angle = rng.next_float() * 6.28318530718f;
+        float r = radius * sqrtf(rng.next_float());
+        
+        // FIXED: Store in temporary float first
+        float resultX = centerX + r * cosf(angle);
+        float resultY = centerY + r * sinf(angle);
+        *outX = amx_ftoc(resultX);
+        *outY = amx_ftoc(resultY);
+        
+        return 1;
+    });
+}
+
+// native bool:CSPRandPointInCircle(Float:centerX, Float:centerY, Float:radius, &Float:outX, &Float:outY);
+static cell AMX_NATIVE_CALL n_CSPRandPointInCircle(AMX* amx, cell* params) {
+    float centerX = amx_ctof(params[1]);
+    float centerY = amx_ctof(params[2]);
+    float radius = amx_ctof(params[3]);
+    
+    if (radius <= 0.0f) return 0;
+    
+    cell *outX, *outY;
+    amx_GetAddr(amx, params[4], &outX);
+    amx_GetAddr(amx, params[5], &outY);
+    
+    if (!outX || !outY) return 0;
+    
+    return RandomixGenerators::VisitCSPRNG(amx, [&](auto& rng) {
+        float angle = rng.next_float() * 6.28318530718f;
+        float r = radius * sqrtf(rng.next_float());
+        
+        // FIXED
+        float resultX = centerX + r * cosf(angle);
+        float resultY = centerY + r * sinf(angle);
+        *outX = amx_ftoc(resultX);
+        *outY = amx_ftoc(resultY);
+        
+        return 1;
+    });
+}
+
+// native bool:PRandPointOnCircle(Float:centerX, Float:centerY, Float:radius, &Float:outX, &Float:outY);
+static cell AMX_NATIVE_CALL n_PRandPointOnCircle(AMX* amx, cell* params) {
+    float centerX = amx_ctof(params[1]);
+    float centerY = amx_ctof(params[2]);
+    float radius = amx_ctof(params[3]);
+    
+    if (radius <= 0.0f) return 0;
+    
+    cell *outX, *outY;
+    amx_GetAddr(amx, params[4], &outX);
+    amx_GetAddr(amx, params[5], &outY);
+    
+    if (!outX || !outY) return 0;
+    
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        float angle = rng.next_float() * 6.28318530718f;
+        
+        // FIXED
+        float resultX = centerX + radius * cosf(angle);
+        float resultY = centerY + radius * sinf(angle);
+        *outX = amx_ftoc(resultX);
+        *outY = amx_ftoc(resultY);
+        
+        return 1;
+    });
+}
+
 // native bool:PRandPointInRect(Float:minX, Float:minY, Float:maxX, Float:maxY, &Float:outX, &Float:outY);
 static cell AMX_NATIVE_CALL n_PRandPointInRect(AMX* amx, cell* params) {
     float minX = amx_ctof(params[1]);
@@ -435,15 +1005,15 @@ static cell AMX_NATIVE_CALL n_PRandPointInRect(AMX* amx, cell* params) {
     
     if (!outX || !outY) return 0;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
-    
-    // FIXED
-    float resultX = minX + RandomixGenerators::GetPRNG().next_float() * (maxX - minX);
-    float resultY = minY + RandomixGenerators::GetPRNG().next_float() * (maxY - minY);
-    *outX = amx_ftoc(resultX);
-    *outY = amx_ftoc(resultY);
-    
-    return 1;
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        // FIXED
+        float resultX = minX + rng.next_float() * (maxX - minX);
+        float resultY = minY + rng.next_float() * (maxY - minY);
+        *outX = amx_ftoc(resultX);
+        *outY = amx_ftoc(resultY);
+        
+        return 1;
+    });
 }
 
 // native bool:PRandPointInRing(Float:centerX, Float:centerY, Float:innerRadius, Float:outerRadius, &Float:outX, &Float:outY);
@@ -461,20 +1031,20 @@ static cell AMX_NATIVE_CALL n_PRandPointInRing(AMX* amx, cell* params) {
     
     if (!outX || !outY) return 0;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
-    
-    float angle = RandomixGenerators::GetPRNG().next_float() * 6.28318530718f;
-    float innerRadiusSq = innerRadius * innerRadius;
-    float outerRadiusSq = outerRadius * outerRadius;
-    float r = sqrtf(innerRadiusSq + RandomixGenerators::GetPRNG().next_float() * (outerRadiusSq - innerRadiusSq));
-    
-    // FIXED
-    float resultX = centerX + r * cosf(angle);
-    float resultY = centerY + r * sinf(angle);
-    *outX = amx_ftoc(resultX);
-    *outY = amx_ftoc(resultY);
-    
-    return 1;
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        float angle = rng.next_float() * 6.28318530718f;
+        float innerRadiusSq = innerRadius * innerRadius;
+        float outerRadiusSq = outerRadius * outerRadius;
+        float r = sqrtf(innerRadiusSq + rng.next_float() * (outerRadiusSq - innerRadiusSq));
+        
+        // FIXED
+        float resultX = centerX + r * cosf(angle);
+        float resultY = centerY + r * sinf(angle);
+        *outX = amx_ftoc(resultX);
+        *outY = amx_ftoc(resultY);
+        
+        return 1;
+    });
 }
 
 // native bool:PRandPointInEllipse(Float:centerX, Float:centerY, Float:radiusX, Float:radiusY, &Float:outX, &Float:outY);
@@ -492,18 +1062,18 @@ static cell AMX_NATIVE_CALL n_PRandPointInEllipse(AMX* amx, cell* params) {
     
     if (!outX || !outY) return 0;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
-    
-    float angle = RandomixGenerators::GetPRNG().next_float() * 6.28318530718f;
-    float r = sqrtf(RandomixGenerators::GetPRNG().next_float());
-    
-    // FIXED
-    float resultX = centerX + radiusX * r * cosf(angle);
-    float resultY = centerY + radiusY * r * sinf(angle);
-    *outX = amx_ftoc(resultX);
-    *outY = amx_ftoc(resultY);
-    
-    return 1;
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        float angle = rng.next_float() * 6.28318530718f;
+        float r = sqrtf(rng.next_float());
+        
+        // FIXED
+        float resultX = centerX + radiusX * r * cosf(angle);
+        float resultY = centerY + radiusY * r * sinf(angle);
+        *outX = amx_ftoc(resultX);
+        *outY = amx_ftoc(resultY);
+        
+        return 1;
+    });
 }
 
 // native bool:PRandPointInTriangle(Float:x1, Float:y1, Float:x2, Float:y2, Float:x3, Float:y3, &Float:outX, &Float:outY);
@@ -521,25 +1091,25 @@ static cell AMX_NATIVE_CALL n_PRandPointInTriangle(AMX* amx, cell* params) {
     
     if (!outX || !outY) return 0;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
-    
-    float r1 = RandomixGenerators::GetPRNG().next_float();
-    float r2 = RandomixGenerators::GetPRNG().next_float();
-    
-    if (r1 + r2 > 1.0f) {
-        r1 = 1.0f - r1;
-        r2 = 1.0f - r2;
-    }
-    
-    float r3 = 1.0f - r1 - r2;
-    
-    // FIXED
-    float resultX = r1 * x1 + r2 * x2 + r3 * x3;
-    float resultY = r1 * y1 + r2 * y2 + r3 * y3;
-    *outX = amx_ftoc(resultX);
-    *outY = amx_ftoc(resultY);
-    
-    return 1;
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        float r1 = rng.next_float();
+        float r2 = rng.next_float();
+        
+        if (r1 + r2 > 1.0f) {
+            r1 = 1.0f - r1;
+            r2 = 1.0f - r2;
+        }
+        
+        float r3 = 1.0f - r1 - r2;
+        
+        // FIXED
+        float resultX = r1 * x1 + r2 * x2 + r3 * x3;
+        float resultY = r1 * y1 + r2 * y2 + r3 * y3;
+        *outX = amx_ftoc(resultX);
+        *outY = amx_ftoc(resultY);
+        
+        return 1;
+    });
 }
 
 // ============================================================================
@@ -562,27 +1132,27 @@ static cell AMX_NATIVE_CALL n_PRandPointInSphere(AMX* amx, cell* params) {
     
     if (!outX || !outY || !outZ) return 0;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
-    
-    float x, y, z, sq;
-    do {
-        x = RandomixGenerators::GetPRNG().next_float() * 2.0f - 1.0f;
-        y = RandomixGenerators::GetPRNG().next_float() * 2.0f - 1.0f;
-        z = RandomixGenerators::GetPRNG().next_float() * 2.0f - 1.0f;
-        sq = x * x + y * y + z * z;
-    } while (sq > 1.0f || sq == 0.0f);
-    
-    float scale = radius * cbrtf(RandomixGenerators::GetPRNG().next_float()) / sqrtf(sq);
-    
-    // FIXED
-    float resultX = centerX + x * scale;
-    float resultY = centerY + y * scale;
-    float resultZ = centerZ + z * scale;
-    *outX = amx_ftoc(resultX);
-    *outY = amx_ftoc(resultY);
-    *outZ = amx_ftoc(resultZ);
-    
-    return 1;
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        float x, y, z, sq;
+        do {
+            x = rng.next_float() * 2.0f - 1.0f;
+            y = rng.next_float() * 2.0f - 1.0f;
+            z = rng.next_float() * 2.0f - 1.0f;
+            sq = x * x + y * y + z * z;
+        } while (sq > 1.0f || sq == 0.0f);
+        
+        float scale = radius * cbrtf(rng.next_float()) / sqrtf(sq);
+        
+        // FIXED
+        float resultX = centerX + x * scale;
+        float resultY = centerY + y * scale;
+        float resultZ = centerZ + z * scale;
+        *outX = amx_ftoc(resultX);
+        *outY = amx_ftoc(resultY);
+        *outZ = amx_ftoc(resultZ);
+        
+        return 1;
+    });
 }
 
 // native bool:CSPRandPointInSphere(Float:centerX, Float:centerY, Float:centerZ, Float:radius, &Float:outX, &Float:outY, &Float:outZ);
@@ -601,27 +1171,27 @@ static cell AMX_NATIVE_CALL n_CSPRandPointInSphere(AMX* amx, cell* params) {
     
     if (!outX || !outY || !outZ) return 0;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::csprng_mutex);
-    
-    float x, y, z, sq;
-    do {
-        x = RandomixGenerators::GetCSPRNG().next_float() * 2.0f - 1.0f;
-        y = RandomixGenerators::GetCSPRNG().next_float() * 2.0f - 1.0f;
-        z = RandomixGenerators::GetCSPRNG().next_float() * 2.0f - 1.0f;
-        sq = x * x + y * y + z * z;
-    } while (sq > 1.0f || sq == 0.0f);
-    
-    float scale = radius * cbrtf(RandomixGenerators::GetCSPRNG().next_float()) / sqrtf(sq);
-    
-    // FIXED
-    float resultX = centerX + x * scale;
-    float resultY = centerY + y * scale;
-    float resultZ = centerZ + z * scale;
-    *outX = amx_ftoc(resultX);
-    *outY = amx_ftoc(resultY);
-    *outZ = amx_ftoc(resultZ);
-    
-    return 1;
+    return RandomixGenerators::VisitCSPRNG(amx, [&](auto& rng) {
+        float x, y, z, sq;
+        do {
+            x = rng.next_float() * 2.0f - 1.0f;
+            y = rng.next_float() * 2.0f - 1.0f;
+            z = rng.next_float() * 2.0f - 1.0f;
+            sq = x * x + y * y + z * z;
+        } while (sq > 1.0f || sq == 0.0f);
+        
+        float scale = radius * cbrtf(rng.next_float()) / sqrtf(sq);
+        
+        // FIXED
+        float resultX = centerX + x * scale;
+        float resultY = centerY + y * scale;
+        float resultZ = centerZ + z * scale;
+        *outX = amx_ftoc(resultX);
+        *outY = amx_ftoc(resultY);
+        *outZ = amx_ftoc(resultZ);
+        
+        return 1;
+    });
 }
 
 // native bool:PRandPointOnSphere(Float:centerX, Float:centerY, Float:centerZ, Float:radius, &Float:outX, &Float:outY, &Float:outZ);
@@ -640,26 +1210,26 @@ static cell AMX_NATIVE_CALL n_PRandPointOnSphere(AMX* amx, cell* params) {
     
     if (!outX || !outY || !outZ) return 0;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
-    
-    float u, v, s;
-    do {
-        u = RandomixGenerators::GetPRNG().next_float() * 2.0f - 1.0f;
-        v = RandomixGenerators::GetPRNG().next_float() * 2.0f - 1.0f;
-        s = u * u + v * v;
-    } while (s >= 1.0f || s == 0.0f);
-    
-    float multiplier = 2.0f * sqrtf(1.0f - s);
-    
-    // FIXED
-    float resultX = centerX + radius * u * multiplier;
-    float resultY = centerY + radius * v * multiplier;
-    float resultZ = centerZ + radius * (1.0f - 2.0f * s);
-    *outX = amx_ftoc(resultX);
-    *outY = amx_ftoc(resultY);
-    *outZ = amx_ftoc(resultZ);
-    
-    return 1;
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        float u, v, s;
+        do {
+            u = rng.next_float() * 2.0f - 1.0f;
+            v = rng.next_float() * 2.0f - 1.0f;
+            s = u * u + v * v;
+        } while (s >= 1.0f || s == 0.0f);
+        
+        float multiplier = 2.0f * sqrtf(1.0f - s);
+        
+        // FIXED
+        float resultX = centerX + radius * u * multiplier;
+        float resultY = centerY + radius * v * multiplier;
+        float resultZ = centerZ + radius * (1.0f - 2.0f * s);
+        *outX = amx_ftoc(resultX);
+        *outY = amx_ftoc(resultY);
+        *outZ = amx_ftoc(resultZ);
+        
+        return 1;
+    });
 }
 
 // native bool:PRandPointInBox(Float:minX, Float:minY, Float:minZ, Float:maxX, Float:maxY, Float:maxZ, &Float:outX, &Float:outY, &Float:outZ);
@@ -682,17 +1252,17 @@ static cell AMX_NATIVE_CALL n_PRandPointInBox(AMX* amx, cell* params) {
     
     if (!outX || !outY || !outZ) return 0;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
-    
-    // FIXED
-    float resultX = minX + RandomixGenerators::GetPRNG().next_float() * (maxX - minX);
-    float resultY = minY + RandomixGenerators::GetPRNG().next_float() * (maxY - minY);
-    float resultZ = minZ + RandomixGenerators::GetPRNG().next_float() * (maxZ - minZ);
-    *outX = amx_ftoc(resultX);
-    *outY = amx_ftoc(resultY);
-    *outZ = amx_ftoc(resultZ);
-    
-    return 1;
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        // FIXED
+        float resultX = minX + rng.next_float() * (maxX - minX);
+        float resultY = minY + rng.next_float() * (maxY - minY);
+        float resultZ = minZ + rng.next_float() * (maxZ - minZ);
+        *outX = amx_ftoc(resultX);
+        *outY = amx_ftoc(resultY);
+        *outZ = amx_ftoc(resultZ);
+        
+        return 1;
+    });
 }
 
 // native bool:PRandPointInPolygon(const Float:vertices[], vertexCount, &Float:outX, &Float:outY);
@@ -707,127 +1277,1124 @@ static cell AMX_NATIVE_CALL n_PRandPointInPolygon(AMX* amx, cell* params) {
     
     if (!verticesPtr || !outX || !outY) return 0;
     
-    std::lock_guard<std::mutex> lock(RandomixGenerators::prng_mutex);
+    const float* vertices = reinterpret_cast<float*>(verticesPtr);
+    float& x = *reinterpret_cast<float*>(outX);
+    float& y = *reinterpret_cast<float*>(outY);
     
-    // Calculate total area using triangulation from first vertex
-    float totalArea = 0.0f;
-    std::vector<float> triangleAreas;
+    // Triangulated per call; PRandPolygonCreate caches it for static zones.
+    // Outlines the triangulation rejects keep the original fan from vertex 0.
+    Polygon polygon;
+    bool clipped = polygon.set_outline(vertices, static_cast<size_t>(vertexCount));
     
-    for (int i = 1; i < vertexCount - 1; i++) {
-        float x1 = amx_ctof(verticesPtr[0]);
-        float y1 = amx_ctof(verticesPtr[1]);
-        float x2 = amx_ctof(verticesPtr[i * 2]);
-        float y2 = amx_ctof(verticesPtr[i * 2 + 1]);
-        float x3 = amx_ctof(verticesPtr[(i + 1) * 2]);
-        float y3 = amx_ctof(verticesPtr[(i + 1) * 2 + 1]);
-        
-        float area = fabsf((x2 - x1) * (y3 - y1) - (x3 - x1) * (y2 - y1)) * 0.5f;
-        triangleAreas.push_back(area);
-        totalArea += area;
-    }
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        if (!clipped) return Polygon::sample_fan(rng, vertices, static_cast<size_t>(vertexCount), x, y) ? 1 : 0;
+        polygon.sample(rng, x, y);
+        return 1;
+    });
+}
+
+// ============================================================================
+// BATCH POINT FUNCTIONS
+// ============================================================================
+
+// Raw draws for the RandomixGeometry kernels, one engine visit per batch
+static std::vector<uint32_t> DrawPointWords(AMX* amx, size_t planes, int count) {
+    std::vector<uint32_t> words(planes * static_cast<size_t>(count));
+    RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        rng.fill(words.data(), words.size());
+    });
+    return words;
+}
+
+// native bool:PRandPointsInCircle(Float:centerX, Float:centerY, Float:radius, Float:x[], Float:y[], count = sizeof x);
+static cell AMX_NATIVE_CALL n_PRandPointsInCircle(AMX* amx, cell* params) {
+    float centerX = amx_ctof(params[1]);
+    float centerY = amx_ctof(params[2]);
+    float radius = amx_ctof(params[3]);
+    int count = static_cast<int>(params[6]);
     
-    if (totalArea <= 0.0f) return 0;
+    if (count <= 0 || radius <= 0.0f) return 0;
     
-    // Select random triangle based on area weights
-    float rand = RandomixGenerators::GetPRNG().next_float() * totalArea;
-    float sum = 0.0f;
-    int selectedTriangle = 0;
+    cell* outX = GetArrayAddress(amx, params[4]);
+    cell* outY = GetArrayAddress(amx, params[5]);
     
-    for (size_t i = 0; i < triangleAreas.size(); i++) {
-        sum += triangleAreas[i];
-        if (rand < sum) {
-            selectedTriangle = static_cast<int>(i);
-            break;
-        }
-    }
+    if (!outX || !outY) return 0;
     
-    // Generate point in selected triangle
-    float x1 = amx_ctof(verticesPtr[0]);
-    float y1 = amx_ctof(verticesPtr[1]);
-    float x2 = amx_ctof(verticesPtr[(selectedTriangle + 1) * 2]);
-    float y2 = amx_ctof(verticesPtr[(selectedTriangle + 1) * 2 + 1]);
-    float x3 = amx_ctof(verticesPtr[(selectedTriangle + 2) * 2]);
-    float y3 = amx_ctof(verticesPtr[(selectedTriangle + 2) * 2 + 1]);
+    std::vector<uint32_t> words = DrawPointWords(amx, RandomixGeometry::DISC_DRAWS, count);
+    RandomixGeometry::disc(words.data(), static_cast<size_t>(count), centerX, centerY, radius, radius, 0.0f, 1.0f,
+        reinterpret_cast<float*>(outX), reinterpret_cast<float*>(outY));
     
-    float r1 = RandomixGenerators::GetPRNG().next_float();
-    float r2 = RandomixGenerators::GetPRNG().next_float();
+    return 1;
+}
+
+// native bool:PRandPointsOnCircle(Float:centerX, Float:centerY, Float:radius, Float:x[], Float:y[], count = sizeof x);
+static cell AMX_NATIVE_CALL n_PRandPointsOnCircle(AMX* amx, cell* params) {
+    float centerX = amx_ctof(params[1]);
+    float centerY = amx_ctof(params[2]);
+    float radius = amx_ctof(params[3]);
+    int count = static_cast<int>(params[6]);
     
-    if (r1 + r2 > 1.0f) {
-        r1 = 1.0f - r1;
-        r2 = 1.0f - r2;
-    }
+    if (count <= 0 || radius <= 0.0f) return 0;
     
-    float r3 = 1.0f - r1 - r2;
+    cell* outX = GetArrayAddress(amx, params[4]);
+    cell* outY = GetArrayAddress(amx, params[5]);
     
-    // FIXED
-    float resultX = r1 * x1 + r2 * x2 + r3 * x3;
-    float resultY = r1 * y1 + r2 * y2 + r3 * y3;
-    *outX = amx_ftoc(resultX);
-    *outY = amx_ftoc(resultY);
+    if (!outX || !outY) return 0;
+    
+    std::vector<uint32_t> words = DrawPointWords(amx, RandomixGeometry::CIRCLE_EDGE_DRAWS, count);
+    RandomixGeometry::circle_edge(words.data(), static_cast<size_t>(count), centerX, centerY, radius,
+        reinterpret_cast<float*>(outX), reinterpret_cast<float*>(outY));
     
     return 1;
 }
 
-// ============================================================================
-// NATIVE FUNCTIONS TABLE - DIPERBARUI DENGAN NATIVE BARU
-// ============================================================================
-
-static const AMX_NATIVE_INFO native_list[] = {
-    // Range Functions
-    {"PRandRange", n_PRandRange},
-    {"CSPRandRange", n_CSPRandRange},
-    {"PRandFloatRange", n_PRandFloatRange},
-    {"CSPRandFloatRange", n_CSPRandFloatRange},
+// native bool:PRandPointsInRing(Float:centerX, Float:centerY, Float:innerRadius, Float:outerRadius, Float:x[], Float:y[], count = sizeof x);
+static cell AMX_NATIVE_CALL n_PRandPointsInRing(AMX* amx, cell* params) {
+    float centerX = amx_ctof(params[1]);
+    float centerY = amx_ctof(params[2]);
+    float innerRadius = amx_ctof(params[3]);
+    float outerRadius = amx_ctof(params[4]);
+    int count = static_cast<int>(params[7]);
     
-    // Seed Functions
-    {"SeedPRNG", n_SeedPRNG},
-    {"SeedCSPRNG", n_SeedCSPRNG},
+    if (count <= 0 || innerRadius < 0.0f || outerRadius <= 0.0f || innerRadius >= outerRadius) return 0;
     
-    // Boolean Functions
-    {"PRandBool", n_PRandBool},
-    {"CSPRandBool", n_CSPRandBool},
-    {"PRandBoolWeighted", n_PRandBoolWeighted},
+    cell* outX = GetArrayAddress(amx, params[5]);
+    cell* outY = GetArrayAddress(amx, params[6]);
     
-    // Array Functions
-    {"PRandWeighted", n_PRandWeighted},
-    {"PRandShuffle", n_PRandShuffle},
-    {"PRandShuffleRange", n_PRandShuffleRange},
+    if (!outX || !outY) return 0;
     
-    // Distribution Functions
-    {"PRandGaussian", n_PRandGaussian},
-    {"PRandDice", n_PRandDice},
+    std::vector<uint32_t> words = DrawPointWords(amx, RandomixGeometry::DISC_DRAWS, count);
+    RandomixGeometry::disc(words.data(), static_cast<size_t>(count), centerX, centerY, 1.0f, 1.0f,
+        innerRadius * innerRadius, outerRadius * outerRadius - innerRadius * innerRadius,
+        reinterpret_cast<float*>(outX), reinterpret_cast<float*>(outY));
     
-    // Cryptographic Functions
-    {"CSPRandToken", n_CSPRandToken},
-    {"CSPRandBytes", n_CSPRandBytes},
-    {"CSPRandUUID", n_CSPRandUUID},
+    return 1;
+}
+
+// native bool:PRandPointsInEllipse(Float:centerX, Float:centerY, Float:radiusX, Float:radiusY, Float:x[], Float:y[], count = sizeof x);
+static cell AMX_NATIVE_CALL n_PRandPointsInEllipse(AMX* amx, cell* params) {
+    float centerX = amx_ctof(params[1]);
+    float centerY = amx_ctof(params[2]);
+    float radiusX = amx_ctof(params[3]);
+    float radiusY = amx_ctof(params[4]);
+    int count = static_cast<int>(params[7]);
     
-    // =============== NEW 2D POINT FUNCTIONS ===============
-    {"PRandPointInCircle", n_PRandPointInCircle},
-    {"CSPRandPointInCircle", n_CSPRandPointInCircle},
-    {"PRandPointOnCircle", n_PRandPointOnCircle},
-    {"PRandPointInRect", n_PRandPointInRect},
-    {"PRandPointInRing", n_PRandPointInRing},
-    {"PRandPointInEllipse", n_PRandPointInEllipse},
-    {"PRandPointInTriangle", n_PRandPointInTriangle},
+    if (count <= 0 || radiusX <= 0.0f || radiusY <= 0.0f) return 0;
     
-    // =============== NEW 3D POINT FUNCTIONS ===============
-    {"PRandPointInSphere", n_PRandPointInSphere},
-    {"CSPRandPointInSphere", n_CSPRandPointInSphere},
-    {"PRandPointOnSphere", n_PRandPointOnSphere},
-    {"PRandPointInBox", n_PRandPointInBox},
+    cell* outX = GetArrayAddress(amx, params[5]);
+    cell* outY = GetArrayAddress(amx, params[6]);
     
-    // =============== NEW ADVANCED GEOMETRIC FUNCTION ===============
-    {"PRandPointInPolygon", n_PRandPointInPolygon},
+    if (!outX || !outY) return 0;
+    
+    std::vector<uint32_t> words = DrawPointWords(amx, RandomixGeometry::DISC_DRAWS, count);
+    RandomixGeometry::disc(words.data(), static_cast<size_t>(count), centerX, centerY, radiusX, radiusY, 0.0f, 1.0f,
+        reinterpret_cast<float*>(outX), reinterpret_cast<float*>(outY));
+    
+    return 1;
+}
+
+// native bool:PRandPointsInRect(Float:minX, Float:minY, Float:maxX, Float:maxY, Float:x[], Float:y[], count = sizeof x);
+static cell AMX_NATIVE_CALL n_PRandPointsInRect(AMX* amx, cell* params) {
+    float minX = amx_ctof(params[1]);
+    float minY = amx_ctof(params[2]);
+    float maxX = amx_ctof(params[3]);
+    float maxY = amx_ctof(params[4]);
+    int count = static_cast<int>(params[7]);
+    
+    if (count <= 0) return 0;
+    
+    cell* outX = GetArrayAddress(amx, params[5]);
+    cell* outY = GetArrayAddress(amx, params[6]);
+    
+    if (!outX || !outY) return 0;
+    
+    std::vector<uint32_t> words = DrawPointWords(amx, RandomixGeometry::RECT_DRAWS, count);
+    RandomixGeometry::rect(words.data(), static_cast<size_t>(count), minX, minY, maxX, maxY,
+        reinterpret_cast<float*>(outX), reinterpret_cast<float*>(outY));
+    
+    return 1;
+}
+
+// native bool:PRandPointsInSphere(Float:centerX, Float:centerY, Float:centerZ, Float:radius, Float:x[], Float:y[], Float:z[], count = sizeof x);
+static cell AMX_NATIVE_CALL n_PRandPointsInSphere(AMX* amx, cell* params) {
+    float centerX = amx_ctof(params[1]);
+    float centerY = amx_ctof(params[2]);
+    float centerZ = amx_ctof(params[3]);
+    float radius = amx_ctof(params[4]);
+    int count = static_cast<int>(params[8]);
+    
+    if (count <= 0 || radius <= 0.0f) return 0;
+    
+    cell* outX = GetArrayAddress(amx, params[5]);
+    cell* outY = GetArrayAddress(amx, params[6]);
+    cell* outZ = GetArrayAddress(amx, params[7]);
+    
+    if (!outX || !outY || !outZ) return 0;
+    
+    std::vector<uint32_t> words = DrawPointWords(amx, RandomixGeometry::SPHERE_DRAWS, count);
+    RandomixGeometry::sphere(words.data(), static_cast<size_t>(count), centerX, centerY, centerZ, radius,
+        reinterpret_cast<float*>(outX), reinterpret_cast<float*>(outY), reinterpret_cast<float*>(outZ));
+    
+    return 1;
+}
+
+// native bool:PRandPointsOnSphere(Float:centerX, Float:centerY, Float:centerZ, Float:radius, Float:x[], Float:y[], Float:z[], count = sizeof x);
+static cell AMX_NATIVE_CALL n_PRandPointsOnSphere(AMX* amx, cell* params) {
+    float centerX = amx_ctof(params[1]);
+    float centerY = amx_ctof(params[2]);
+    float centerZ = amx_ctof(params[3]);
+    float radius = amx_ctof(params[4]);
+    int count = static_cast<int>(params[8]);
+    
+    if (count <= 0 || radius <= 0.0f) return 0;
+    
+    cell* outX = GetArrayAddress(amx, params[5]);
+    cell* outY = GetArrayAddress(amx, params[6]);
+    cell* outZ = GetArrayAddress(amx, params[7]);
+    
+    if (!outX || !outY || !outZ) return 0;
+    
+    std::vector<uint32_t> words = DrawPointWords(amx, RandomixGeometry::SPHERE_SURFACE_DRAWS, count);
+    RandomixGeometry::sphere_surface(words.data(), static_cast<size_t>(count), centerX, centerY, centerZ, radius,
+        reinterpret_cast<float*>(outX), reinterpret_cast<float*>(outY), reinterpret_cast<float*>(outZ));
+    
+    return 1;
+}
+
+// native bool:PRandPointsInBox(Float:minX, Float:minY, Float:minZ, Float:maxX, Float:maxY, Float:maxZ, Float:x[], Float:y[], Float:z[], count = sizeof x);
+static cell AMX_NATIVE_CALL n_PRandPointsInBox(AMX* amx, cell* params) {
+    float minX = amx_ctof(params[1]);
+    float minY = amx_ctof(params[2]);
+    float minZ = amx_ctof(params[3]);
+    float maxX = amx_ctof(params[4]);
+    float maxY = amx_ctof(params[5]);
+    float maxZ = amx_ctof(params[6]);
+    int count = static_cast<int>(params[10]);
+    
+    if (count <= 0) return 0;
+    
+    cell* outX = GetArrayAddress(amx, params[7]);
+    cell* outY = GetArrayAddress(amx, params[8]);
+    cell* outZ = GetArrayAddress(amx, params[9]);
+    
+    if (!outX || !outY || !outZ) return 0;
+    
+    std::vector<uint32_t> words = DrawPointWords(amx, RandomixGeometry::BOX_DRAWS, count);
+    RandomixGeometry::box(words.data(), static_cast<size_t>(count), minX, minY, minZ, maxX, maxY, maxZ,
+        reinterpret_cast<float*>(outX), reinterpret_cast<float*>(outY), reinterpret_cast<float*>(outZ));
+    
+    return 1;
+}
+
+// ============================================================================
+// ALIAS TABLE FUNCTIONS
+// ============================================================================
+
+// native PRandAlias:PRandAliasCreate(const weights[], count = sizeof weights);
+static cell AMX_NATIVE_CALL n_PRandAliasCreate(AMX* amx, cell* params) {
+    int count = static_cast<int>(params[2]);
+    if (count <= 0) return 0;
+    
+    cell* weights = GetArrayAddress(amx, params[1]);
+    if (!weights) return 0;
+    
+    std::unique_ptr<AliasTable> table(new AliasTable());
+    if (!table->build(reinterpret_cast<const int32_t*>(weights), static_cast<size_t>(count))) return 0;
+    
+    return RandomixGenerators::GetContext(amx).alias_tables.add(std::move(table));
+}
+
+// native PRandAliasPick(PRandAlias:table);
+static cell AMX_NATIVE_CALL n_PRandAliasPick(AMX* amx, cell* params) {
+    const AliasTable* table = RandomixGenerators::GetContext(amx).alias_tables.get(static_cast<int>(params[1]));
+    if (!table) return -1;
+    
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        return static_cast<cell>(table->pick(rng));
+    });
+}
+
+// native bool:PRandAliasPickMany(PRandAlias:table, dest[], count = sizeof dest);
+static cell AMX_NATIVE_CALL n_PRandAliasPickMany(AMX* amx, cell* params) {
+    int count = static_cast<int>(params[3]);
+    if (count <= 0) return 0;
+    
+    const AliasTable* table = RandomixGenerators::GetContext(amx).alias_tables.get(static_cast<int>(params[1]));
+    if (!table) return 0;
+    
+    cell* dest = GetArrayAddress(amx, params[2]);
+    if (!dest) return 0;
+    
+    RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        for (int i = 0; i < count; i++) {
+            dest[i] = static_cast<cell>(table->pick(rng));
+        }
+    });
+    return 1;
+}
+
+// native bool:PRandAliasDestroy(PRandAlias:table);
+static cell AMX_NATIVE_CALL n_PRandAliasDestroy(AMX* amx, cell* params) {
+    return RandomixGenerators::GetContext(amx).alias_tables.remove(static_cast<int>(params[1])) ? 1 : 0;
+}
+
+// ============================================================================
+// WEIGHTED SET FUNCTIONS
+// ============================================================================
+
+// native PRandWeightedSet:PRandWeightedSetCreate(size);
+static cell AMX_NATIVE_CALL n_PRandWeightedSetCreate(AMX* amx, cell* params) {
+    int size = static_cast<int>(params[1]);
+    if (size <= 0 || static_cast<size_t>(size) > WeightedSet::MAX_SIZE) return 0;
+    
+    std::unique_ptr<WeightedSet> set(new WeightedSet(static_cast<size_t>(size)));
+    return RandomixGenerators::GetContext(amx).weighted_sets.add(std::move(set));
+}
+
+// native PRandWeightedSet:PRandWeightedSetFromArray(const weights[], count = sizeof weights);
+static cell AMX_NATIVE_CALL n_PRandWeightedSetFromArray(AMX* amx, cell* params) {
+    int count = static_cast<int>(params[2]);
+    if (count <= 0 || static_cast<size_t>(count) > WeightedSet::MAX_SIZE) return 0;
+    
+    cell* weights = GetArrayAddress(amx, params[1]);
+    if (!weights) return 0;
+    
+    std::unique_ptr<WeightedSet> set(new WeightedSet(static_cast<size_t>(count)));
+    set->assign(reinterpret_cast<const int32_t*>(weights), static_cast<size_t>(count));
+    return RandomixGenerators::GetContext(amx).weighted_sets.add(std::move(set));
+}
+
+// native bool:PRandWeightedSetSetWeight(PRandWeightedSet:set, index, weight);
+static cell AMX_NATIVE_CALL n_PRandWeightedSetSetWeight(AMX* amx, cell* params) {
+    WeightedSet* set = RandomixGenerators::GetContext(amx).weighted_sets.get(static_cast<int>(params[1]));
+    int index = static_cast<int>(params[2]);
+    int weight = static_cast<int>(params[3]);
+    
+    if (!set || index < 0 || static_cast<size_t>(index) >= set->size()) return 0;
+    
+    set->set_weight(static_cast<size_t>(index), weight > 0 ? static_cast<uint32_t>(weight) : 0u);
+    return 1;
+}
+
+// native PRandWeightedSetGetWeight(PRandWeightedSet:set, index);
+static cell AMX_NATIVE_CALL n_PRandWeightedSetGetWeight(AMX* amx, cell* params) {
+    WeightedSet* set = RandomixGenerators::GetContext(amx).weighted_sets.get(static_cast<int>(params[1]));
+    int index = static_cast<int>(params[2]);
+    
+    if (!set || index < 0 || static_cast<size_t>(index) >= set->size()) return -1;
+    
+    return static_cast<cell>(set->weight(static_cast<size_t>(index)));
+}
+
+// native PRandWeightedSetPick(PRandWeightedSet:set);
+static cell AMX_NATIVE_CALL n_PRandWeightedSetPick(AMX* amx, cell* params) {
+    WeightedSet* set = RandomixGenerators::GetContext(amx).weighted_sets.get(static_cast<int>(params[1]));
+    if (!set || set->total() == 0) return -1;
+    
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        return static_cast<cell>(set->pick(rng));
+    });
+}
+
+// native PRandWeightedSetPickAndRemove(PRandWeightedSet:set);
+static cell AMX_NATIVE_CALL n_PRandWeightedSetPickAndRemove(AMX* amx, cell* params) {
+    WeightedSet* set = RandomixGenerators::GetContext(amx).weighted_sets.get(static_cast<int>(params[1]));
+    if (!set || set->total() == 0) return -1;
+    
+    size_t index = RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        return set->pick(rng);
+    });
+    set->set_weight(index, 0);
+    return static_cast<cell>(index);
+}
+
+// native bool:PRandWeightedSetDestroy(PRandWeightedSet:set);
+static cell AMX_NATIVE_CALL n_PRandWeightedSetDestroy(AMX* amx, cell* params) {
+    return RandomixGenerators::GetContext(amx).weighted_sets.remove(static_cast<int>(params[1])) ? 1 : 0;
+}
+
+// ============================================================================
+// DECK FUNCTIONS
+// ============================================================================
+
+// Runs fn on the generator a deck was created with
+template <typename F>
+static auto VisitDeck(AMX* amx, const Deck& deck, F&& fn) -> decltype(fn(std::declval<PCG32&>())) {
+    if (deck.source == Deck::Source::CSPRNG) {
+        return RandomixGenerators::VisitCSPRNG(amx, std::forward<F>(fn));
+    }
+    return RandomixGenerators::VisitPRNG(amx, std::forward<F>(fn));
+}
+
+// native PRandDeck:PRandDeckCreate(deckSize = 52, decks = 1, PRandDeckSource:source = PRAND_DECK_PRNG);
+static cell AMX_NATIVE_CALL n_PRandDeckCreate(AMX* amx, cell* params) {
+    int deckSize = static_cast<int>(params[1]);
+    int decks = static_cast<int>(params[2]);
+    int source = static_cast<int>(params[3]);
+    
+    if (deckSize <= 0 || decks <= 0 || source < 0 || source > 1) return 0;
+    if (static_cast<uint64_t>(deckSize) * static_cast<uint64_t>(decks) > Deck::MAX_CARDS) return 0;
+    
+    std::unique_ptr<Deck> deck(new Deck(static_cast<uint32_t>(deckSize), static_cast<uint32_t>(decks),
+        static_cast<Deck::Source>(source)));
+    return RandomixGenerators::GetContext(amx).decks.add(std::move(deck));
+}
+
+// native PRandDeckDraw(PRandDeck:deck);
+static cell AMX_NATIVE_CALL n_PRandDeckDraw(AMX* amx, cell* params) {
+    Deck* deck = RandomixGenerators::GetContext(amx).decks.get(static_cast<int>(params[1]));
+    if (!deck) return -1;
+    
+    return VisitDeck(amx, *deck, [&](auto& rng) {
+        return static_cast<cell>(deck->draw(rng));
+    });
+}
+
+// native PRandDeckDrawMany(PRandDeck:deck, dest[], count = sizeof dest);
+static cell AMX_NATIVE_CALL n_PRandDeckDrawMany(AMX* amx, cell* params) {
+    int count = static_cast<int>(params[3]);
+    if (count <= 0) return 0;
+    
+    Deck* deck = RandomixGenerators::GetContext(amx).decks.get(static_cast<int>(params[1]));
+    if (!deck) return 0;
+    
+    cell* dest = GetArrayAddress(amx, params[2]);
+    if (!dest) return 0;
+    
+    return VisitDeck(amx, *deck, [&](auto& rng) {
+        cell dealt = 0;
+        while (dealt < count) {
+            int card = deck->draw(rng);
+            if (card < 0) break;
+            dest[dealt++] = card;
+        }
+        return dealt;
+    });
+}
+
+// native bool:PRandDeckShuffle(PRandDeck:deck);
+static cell AMX_NATIVE_CALL n_PRandDeckShuffle(AMX* amx, cell* params) {
+    Deck* deck = RandomixGenerators::GetContext(amx).decks.get(static_cast<int>(params[1]));
+    if (!deck) return 0;
+    
+    VisitDeck(amx, *deck, [&](auto& rng) {
+        deck->shuffle(rng);
+    });
+    return 1;
+}
+
+// native PRandDeckRemaining(PRandDeck:deck);
+static cell AMX_NATIVE_CALL n_PRandDeckRemaining(AMX* amx, cell* params) {
+    Deck* deck = RandomixGenerators::GetContext(amx).decks.get(static_cast<int>(params[1]));
+    if (!deck) return -1;
+    
+    return static_cast<cell>(deck->remaining());
+}
+
+// native bool:PRandDeckSetCut(PRandDeck:deck, minDealt, maxDealt);
+static cell AMX_NATIVE_CALL n_PRandDeckSetCut(AMX* amx, cell* params) {
+    Deck* deck = RandomixGenerators::GetContext(amx).decks.get(static_cast<int>(params[1]));
+    int minDealt = static_cast<int>(params[2]);
+    int maxDealt = static_cast<int>(params[3]);
+    
+    if (!deck || minDealt < 0 || maxDealt < 0) return 0;
+    
+    VisitDeck(amx, *deck, [&](auto& rng) {
+        deck->set_cut(rng, static_cast<size_t>(minDealt), static_cast<size_t>(maxDealt));
+    });
+    return 1;
+}
+
+// native bool:PRandDeckCutReached(PRandDeck:deck);
+static cell AMX_NATIVE_CALL n_PRandDeckCutReached(AMX* amx, cell* params) {
+    Deck* deck = RandomixGenerators::GetContext(amx).decks.get(static_cast<int>(params[1]));
+    return deck && deck->cut_reached() ? 1 : 0;
+}
+
+// native bool:PRandDeckSetAutoShuffle(PRandDeck:deck, threshold);
+static cell AMX_NATIVE_CALL n_PRandDeckSetAutoShuffle(AMX* amx, cell* params) {
+    Deck* deck = RandomixGenerators::GetContext(amx).decks.get(static_cast<int>(params[1]));
+    int threshold = static_cast<int>(params[2]);
+    
+    if (!deck) return 0;
+    
+    deck->set_auto_shuffle(threshold < 0 ? -1 : threshold);
+    return 1;
+}
+
+// native bool:PRandDeckDestroy(PRandDeck:deck);
+static cell AMX_NATIVE_CALL n_PRandDeckDestroy(AMX* amx, cell* params) {
+    return RandomixGenerators::GetContext(amx).decks.remove(static_cast<int>(params[1])) ? 1 : 0;
+}
+
+// ============================================================================
+// PERMUTATION FUNCTIONS
+// ============================================================================
+
+// native PRandPerm:PRandPermCreate(n, key = 0, keyHi = 0);
+static cell AMX_NATIVE_CALL n_PRandPermCreate(AMX* amx, cell* params) {
+    int n = static_cast<int>(params[1]);
+    if (n <= 0) return 0;
+    
+    std::unique_ptr<FeistelPermutation> perm;
+    uint64_t seed = Join64(params[3], params[2]);
+    
+    // A fixed key always gives the same order; key 0 takes fresh keys from ChaCha
+    if (seed != 0) {
+        PCG32 rng(seed);
+        perm.reset(new FeistelPermutation(static_cast<uint32_t>(n), rng));
+    } else {
+        RandomixGenerators::VisitCSPRNG(amx, [&](auto& rng) {
+            perm.reset(new FeistelPermutation(static_cast<uint32_t>(n), rng));
+        });
+    }
+    return RandomixGenerators::GetContext(amx).permutations.add(std::move(perm));
+}
+
+// native PRandPermGet(PRandPerm:perm, index);
+static cell AMX_NATIVE_CALL n_PRandPermGet(AMX* amx, cell* params) {
+    const FeistelPermutation* perm = RandomixGenerators::GetContext(amx).permutations.get(static_cast<int>(params[1]));
+    int index = static_cast<int>(params[2]);
+    
+    if (!perm || index < 0 || static_cast<uint32_t>(index) >= perm->size()) return -1;
+    
+    return static_cast<cell>(perm->forward(static_cast<uint32_t>(index)));
+}
+
+// native PRandPermInverse(PRandPerm:perm, value);
+static cell AMX_NATIVE_CALL n_PRandPermInverse(AMX* amx, cell* params) {
+    const FeistelPermutation* perm = RandomixGenerators::GetContext(amx).permutations.get(static_cast<int>(params[1]));
+    int value = static_cast<int>(params[2]);
+    
+    if (!perm || value < 0 || static_cast<uint32_t>(value) >= perm->size()) return -1;
+    
+    return static_cast<cell>(perm->inverse(static_cast<uint32_t>(value)));
+}
+
+// native bool:PRandPermDestroy(PRandPerm:perm);
+static cell AMX_NATIVE_CALL n_PRandPermDestroy(AMX* amx, cell* params) {
+    return RandomixGenerators::GetContext(amx).permutations.remove(static_cast<int>(params[1])) ? 1 : 0;
+}
+
+// ============================================================================
+// DICE EXPRESSION FUNCTIONS
+// ============================================================================
+
+// Longest expression text read from a script
+static const int MAX_DICE_EXPRESSION = 256;
+
+static std::string GetDiceString(AMX* amx, cell param) {
+    cell* addr = GetArrayAddress(amx, param);
+    if (!addr) return std::string();
+    
+    int length = 0;
+    amx_StrLen(addr, &length);
+    if (length <= 0) return std::string();
+    if (length > MAX_DICE_EXPRESSION) length = MAX_DICE_EXPRESSION;
+    
+    std::vector<char> text(static_cast<size_t>(length) + 1);
+    amx_GetString(text.data(), addr, 0, text.size());
+    return std::string(text.data());
+}
+
+// native PRandDiceRoll(const expression[]);
+static cell AMX_NATIVE_CALL n_PRandDiceRoll(AMX* amx, cell* params) {
+    const DiceExpression* expr = RandomixGenerators::GetContext(amx).dice(GetDiceString(amx, params[1]));
+    if (!expr) return 0;
+    
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        return static_cast<cell>(expr->roll(rng));
+    });
+}
+
+// native PRandDiceExpr:PRandDiceCompile(const expression[]);
+static cell AMX_NATIVE_CALL n_PRandDiceCompile(AMX* amx, cell* params) {
+    std::unique_ptr<DiceExpression> expr(new DiceExpression());
+    if (!expr->parse(GetDiceString(amx, params[1]).c_str())) return 0;
+    
+    return RandomixGenerators::GetContext(amx).dice_expressions.add(std::move(expr));
+}
+
+// native PRandDiceEval(PRandDiceExpr:expr);
+static cell AMX_NATIVE_CALL n_PRandDiceEval(AMX* amx, cell* params) {
+    const DiceExpression* expr = RandomixGenerators::GetContext(amx).dice_expressions.get(static_cast<int>(params[1]));
+    if (!expr) return 0;
+    
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        return static_cast<cell>(expr->roll(rng));
+    });
+}
+
+// native bool:PRandDiceEvalMany(PRandDiceExpr:expr, dest[], count = sizeof dest);
+static cell AMX_NATIVE_CALL n_PRandDiceEvalMany(AMX* amx, cell* params) {
+    int count = static_cast<int>(params[3]);
+    if (count <= 0) return 0;
+    
+    const DiceExpression* expr = RandomixGenerators::GetContext(amx).dice_expressions.get(static_cast<int>(params[1]));
+    if (!expr) return 0;
+    
+    cell* dest = GetArrayAddress(amx, params[2]);
+    if (!dest) return 0;
+    
+    RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        for (int i = 0; i < count; i++) {
+            dest[i] = static_cast<cell>(expr->roll(rng));
+        }
+    });
+    return 1;
+}
+
+// native bool:PRandDiceFree(PRandDiceExpr:expr);
+static cell AMX_NATIVE_CALL n_PRandDiceFree(AMX* amx, cell* params) {
+    return RandomixGenerators::GetContext(amx).dice_expressions.remove(static_cast<int>(params[1])) ? 1 : 0;
+}
+
+// ============================================================================
+// POLYGON FUNCTIONS
+// ============================================================================
+
+// native PRandPolygon:PRandPolygonCreate(const Float:vertices[], vertexCount);
+static cell AMX_NATIVE_CALL n_PRandPolygonCreate(AMX* amx, cell* params) {
+    int vertexCount = static_cast<int>(params[2]);
+    if (vertexCount < 3) return 0;
+    
+    cell* verticesPtr = GetArrayAddress(amx, params[1]);
+    if (!verticesPtr) return 0;
+    
+    std::unique_ptr<Polygon> polygon(new Polygon());
+    if (!polygon->set_outline(reinterpret_cast<float*>(verticesPtr), static_cast<size_t>(vertexCount))) return 0;
+    
+    return RandomixGenerators::GetContext(amx).polygons.add(std::move(polygon));
+}
+
+// native bool:PRandPolygonAddHole(PRandPolygon:polygon, const Float:vertices[], vertexCount);
+static cell AMX_NATIVE_CALL n_PRandPolygonAddHole(AMX* amx, cell* params) {
+    Polygon* polygon = RandomixGenerators::GetContext(amx).polygons.get(static_cast<int>(params[1]));
+    int vertexCount = static_cast<int>(params[3]);
+    if (!polygon || vertexCount < 3) return 0;
+    
+    cell* verticesPtr = GetArrayAddress(amx, params[2]);
+    if (!verticesPtr) return 0;
+    
+    return polygon->add_hole(reinterpret_cast<float*>(verticesPtr), static_cast<size_t>(vertexCount)) ? 1 : 0;
+}
+
+// native bool:PRandPolygonPoint(PRandPolygon:polygon, &Float:x, &Float:y);
+static cell AMX_NATIVE_CALL n_PRandPolygonPoint(AMX* amx, cell* params) {
+    const Polygon* polygon = RandomixGenerators::GetContext(amx).polygons.get(static_cast<int>(params[1]));
+    if (!polygon) return 0;
+    
+    cell *outX, *outY;
+    amx_GetAddr(amx, params[2], &outX);
+    amx_GetAddr(amx, params[3], &outY);
+    if (!outX || !outY) return 0;
+    
+    RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        polygon->sample(rng, *reinterpret_cast<float*>(outX), *reinterpret_cast<float*>(outY));
+    });
+    return 1;
+}
+
+// native bool:PRandPolygonPoints(PRandPolygon:polygon, Float:x[], Float:y[], count = sizeof x);
+static cell AMX_NATIVE_CALL n_PRandPolygonPoints(AMX* amx, cell* params) {
+    int count = static_cast<int>(params[4]);
+    if (count <= 0) return 0;
+    
+    const Polygon* polygon = RandomixGenerators::GetContext(amx).polygons.get(static_cast<int>(params[1]));
+    if (!polygon) return 0;
+    
+    cell* outX = GetArrayAddress(amx, params[2]);
+    cell* outY = GetArrayAddress(amx, params[3]);
+    if (!outX || !outY) return 0;
+    
+    float* xs = reinterpret_cast<float*>(outX);
+    float* ys = reinterpret_cast<float*>(outY);
+    RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        for (int i = 0; i < count; i++) {
+            polygon->sample(rng, xs[i], ys[i]);
+        }
+    });
+    return 1;
+}
+
+// native Float:PRandPolygonArea(PRandPolygon:polygon);
+static cell AMX_NATIVE_CALL n_PRandPolygonArea(AMX* amx, cell* params) {
+    const Polygon* polygon = RandomixGenerators::GetContext(amx).polygons.get(static_cast<int>(params[1]));
+    float area = polygon ? static_cast<float>(polygon->area()) : 0.0f;
+    return amx_ftoc(area);
+}
+
+// native bool:PRandPolygonDestroy(PRandPolygon:polygon);
+static cell AMX_NATIVE_CALL n_PRandPolygonDestroy(AMX* amx, cell* params) {
+    return RandomixGenerators::GetContext(amx).polygons.remove(static_cast<int>(params[1])) ? 1 : 0;
+}
+
+// ============================================================================
+// POISSON-DISC FUNCTIONS
+// ============================================================================
+
+// native PRandPoissonRect(Float:minX, Float:minY, Float:maxX, Float:maxY, Float:minDistance, Float:x[], Float:y[], maxPoints = sizeof x);
+static cell AMX_NATIVE_CALL n_PRandPoissonRect(AMX* amx, cell* params) {
+    float minX = amx_ctof(params[1]);
+    float minY = amx_ctof(params[2]);
+    float maxX = amx_ctof(params[3]);
+    float maxY = amx_ctof(params[4]);
+    float minDistance = amx_ctof(params[5]);
+    int maxPoints = static_cast<int>(params[8]);
+    
+    if (maxPoints <= 0 || minDistance <= 0.0f) return 0;
+    
+    cell* outX = GetArrayAddress(amx, params[6]);
+    cell* outY = GetArrayAddress(amx, params[7]);
+    if (!outX || !outY) return 0;
+    
+    RandomixPoisson::Rect region = { std::min(minX, maxX), std::min(minY, maxY), std::max(minX, maxX), std::max(minY, maxY) };
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        return static_cast<cell>(RandomixPoisson::fill(rng, region, minDistance,
+            reinterpret_cast<float*>(outX), reinterpret_cast<float*>(outY), static_cast<size_t>(maxPoints)));
+    });
+}
+
+// native PRandPoissonCircle(Float:centerX, Float:centerY, Float:radius, Float:minDistance, Float:x[], Float:y[], maxPoints = sizeof x);
+static cell AMX_NATIVE_CALL n_PRandPoissonCircle(AMX* amx, cell* params) {
+    float centerX = amx_ctof(params[1]);
+    float centerY = amx_ctof(params[2]);
+    float radius = amx_ctof(params[3]);
+    float minDistance = amx_ctof(params[4]);
+    int maxPoints = static_cast<int>(params[7]);
+    
+    if (maxPoints <= 0 || minDistance <= 0.0f || radius <= 0.0f) return 0;
+    
+    cell* outX = GetArrayAddress(amx, params[5]);
+    cell* outY = GetArrayAddress(amx, params[6]);
+    if (!outX || !outY) return 0;
+    
+    RandomixPoisson::Disc region = { centerX, centerY, radius };
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        return static_cast<cell>(RandomixPoisson::fill(rng, region, minDistance,
+            reinterpret_cast<float*>(outX), reinterpret_cast<float*>(outY), static_cast<size_t>(maxPoints)));
+    });
+}
+
+// native PRandPoissonPolygon(PRandPolygon:polygon, Float:minDistance, Float:x[], Float:y[], maxPoints = sizeof x);
+static cell AMX_NATIVE_CALL n_PRandPoissonPolygon(AMX* amx, cell* params) {
+    float minDistance = amx_ctof(params[2]);
+    int maxPoints = static_cast<int>(params[5]);
+    
+    if (maxPoints <= 0 || minDistance <= 0.0f) return 0;
+    
+    const Polygon* polygon = RandomixGenerators::GetContext(amx).polygons.get(static_cast<int>(params[1]));
+    if (!polygon) return 0;
+    
+    cell* outX = GetArrayAddress(amx, params[3]);
+    cell* outY = GetArrayAddress(amx, params[4]);
+    if (!outX || !outY) return 0;
+    
+    return RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        return static_cast<cell>(RandomixPoisson::fill(rng, *polygon, minDistance,
+            reinterpret_cast<float*>(outX), reinterpret_cast<float*>(outY), static_cast<size_t>(maxPoints)));
+    });
+}
+
+// ============================================================================
+// POLYLINE FUNCTIONS
+// ============================================================================
+
+// native PRandPolyline:PRandPolylineCreate(const Float:points[], pointCount, bool:is3D = false, bool:closed = false);
+static cell AMX_NATIVE_CALL n_PRandPolylineCreate(AMX* amx, cell* params) {
+    int pointCount = static_cast<int>(params[2]);
+    if (pointCount < 2) return 0;
+    
+    cell* pointsPtr = GetArrayAddress(amx, params[1]);
+    if (!pointsPtr) return 0;
+    
+    std::unique_ptr<Polyline> line(new Polyline(params[3] ? 3 : 2));
+    if (!line->append(reinterpret_cast<float*>(pointsPtr), static_cast<size_t>(pointCount), params[4] != 0)) return 0;
+    
+    return RandomixGenerators::GetContext(amx).polylines.add(std::move(line));
+}
+
+// native bool:PRandPolylineAppend(PRandPolyline:line, const Float:points[], pointCount, bool:closed = false);
+static cell AMX_NATIVE_CALL n_PRandPolylineAppend(AMX* amx, cell* params) {
+    Polyline* line = RandomixGenerators::GetContext(amx).polylines.get(static_cast<int>(params[1]));
+    int pointCount = static_cast<int>(params[3]);
+    if (!line || pointCount < 2) return 0;
+    
+    cell* pointsPtr = GetArrayAddress(amx, params[2]);
+    if (!pointsPtr) return 0;
+    
+    return line->append(reinterpret_cast<float*>(pointsPtr), static_cast<size_t>(pointCount), params[4] != 0) ? 1 : 0;
+}
+
+// native bool:PRandPolylinePoint(PRandPolyline:line, &Float:x, &Float:y, &Float:z = 0.0, Float:jitter = 0.0);
+static cell AMX_NATIVE_CALL n_PRandPolylinePoint(AMX* amx, cell* params) {
+    const Polyline* line = RandomixGenerators::GetContext(amx).polylines.get(static_cast<int>(params[1]));
+    if (!line) return 0;
+    
+    cell *outX, *outY, *outZ;
+    amx_GetAddr(amx, params[2], &outX);
+    amx_GetAddr(amx, params[3], &outY);
+    amx_GetAddr(amx, params[4], &outZ);
+    float jitter = amx_ctof(params[5]);
+    if (!outX || !outY || !outZ) return 0;
+    
+    RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        line->sample(rng, jitter, *reinterpret_cast<float*>(outX), *reinterpret_cast<float*>(outY),
+            *reinterpret_cast<float*>(outZ));
+    });
+    return 1;
+}
+
+// native bool:PRandPolylinePoints(PRandPolyline:line, Float:x[], Float:y[], Float:z[], count = sizeof x, Float:jitter = 0.0);
+static cell AMX_NATIVE_CALL n_PRandPolylinePoints(AMX* amx, cell* params) {
+    int count = static_cast<int>(params[5]);
+    float jitter = amx_ctof(params[6]);
+    if (count <= 0) return 0;
+    
+    const Polyline* line = RandomixGenerators::GetContext(amx).polylines.get(static_cast<int>(params[1]));
+    if (!line) return 0;
+    
+    cell* outX = GetArrayAddress(amx, params[2]);
+    cell* outY = GetArrayAddress(amx, params[3]);
+    cell* outZ = GetArrayAddress(amx, params[4]);
+    if (!outX || !outY || !outZ) return 0;
+    
+    float* xs = reinterpret_cast<float*>(outX);
+    float* ys = reinterpret_cast<float*>(outY);
+    float* zs = reinterpret_cast<float*>(outZ);
+    RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        for (int i = 0; i < count; i++) {
+            line->sample(rng, jitter, xs[i], ys[i], zs[i]);
+        }
+    });
+    return 1;
+}
+
+// native bool:PRandPolylineAt(PRandPolyline:line, Float:distance, &Float:x, &Float:y, &Float:z = 0.0);
+static cell AMX_NATIVE_CALL n_PRandPolylineAt(AMX* amx, cell* params) {
+    const Polyline* line = RandomixGenerators::GetContext(amx).polylines.get(static_cast<int>(params[1]));
+    if (!line) return 0;
+    
+    cell *outX, *outY, *outZ;
+    amx_GetAddr(amx, params[3], &outX);
+    amx_GetAddr(amx, params[4], &outY);
+    amx_GetAddr(amx, params[5], &outZ);
+    if (!outX || !outY || !outZ) return 0;
+    
+    line->at(amx_ctof(params[2]), *reinterpret_cast<float*>(outX), *reinterpret_cast<float*>(outY),
+        *reinterpret_cast<float*>(outZ));
+    return 1;
+}
+
+// native Float:PRandPolylineLength(PRandPolyline:line);
+static cell AMX_NATIVE_CALL n_PRandPolylineLength(AMX* amx, cell* params) {
+    const Polyline* line = RandomixGenerators::GetContext(amx).polylines.get(static_cast<int>(params[1]));
+    float length = line ? static_cast<float>(line->length()) : 0.0f;
+    return amx_ftoc(length);
+}
+
+// native bool:PRandPolylineDestroy(PRandPolyline:line);
+static cell AMX_NATIVE_CALL n_PRandPolylineDestroy(AMX* amx, cell* params) {
+    return RandomixGenerators::GetContext(amx).polylines.remove(static_cast<int>(params[1])) ? 1 : 0;
+}
+
+// ============================================================================
+// ZONE SET FUNCTIONS
+// ============================================================================
+
+static cell AddZone(AMX* amx, cell handle, const RandomixZones::Zone& zone) {
+    ZoneSet* set = RandomixGenerators::GetContext(amx).zone_sets.get(static_cast<int>(handle));
+    return set && set->add(zone) ? 1 : 0;
+}
+
+// native PRandZoneSet:PRandZoneSetCreate();
+static cell AMX_NATIVE_CALL n_PRandZoneSetCreate(AMX* amx, cell*) {
+    return RandomixGenerators::GetContext(amx).zone_sets.add(std::unique_ptr<ZoneSet>(new ZoneSet()));
+}
+
+// native bool:PRandZoneSetAddBox(PRandZoneSet:set, Float:minX, Float:minY, Float:minZ, Float:maxX, Float:maxY, Float:maxZ);
+static cell AMX_NATIVE_CALL n_PRandZoneSetAddBox(AMX* amx, cell* params) {
+    float minX = amx_ctof(params[2]);
+    float minY = amx_ctof(params[3]);
+    float minZ = amx_ctof(params[4]);
+    float maxX = amx_ctof(params[5]);
+    float maxY = amx_ctof(params[6]);
+    float maxZ = amx_ctof(params[7]);
+    
+    return AddZone(amx, params[1], RandomixZones::Box{ std::min(minX, maxX), std::min(minY, maxY), std::min(minZ, maxZ),
+        std::max(minX, maxX), std::max(minY, maxY), std::max(minZ, maxZ) });
+}
+
+// native bool:PRandZoneSetAddOrientedBox(PRandZoneSet:set, Float:centerX, Float:centerY, Float:centerZ, Float:sizeX, Float:sizeY, Float:sizeZ, Float:rotZ);
+static cell AMX_NATIVE_CALL n_PRandZoneSetAddOrientedBox(AMX* amx, cell* params) {
+    float sizeX = amx_ctof(params[5]);
+    float sizeY = amx_ctof(params[6]);
+    float sizeZ = amx_ctof(params[7]);
+    float angle = amx_ctof(params[8]) * 0.01745329252f;
+    
+    return AddZone(amx, params[1], RandomixZones::OrientedBox{ amx_ctof(params[2]), amx_ctof(params[3]), amx_ctof(params[4]),
+        std::fabs(sizeX) * 0.5f, std::fabs(sizeY) * 0.5f, std::fabs(sizeZ) * 0.5f, std::cos(angle), std::sin(angle) });
+}
+
+// native bool:PRandZoneSetAddSphere(PRandZoneSet:set, Float:centerX, Float:centerY, Float:centerZ, Float:radius);
+static cell AMX_NATIVE_CALL n_PRandZoneSetAddSphere(AMX* amx, cell* params) {
+    float radius = amx_ctof(params[5]);
+    if (radius <= 0.0f) return 0;
+    
+    return AddZone(amx, params[1], RandomixZones::Sphere{ amx_ctof(params[2]), amx_ctof(params[3]), amx_ctof(params[4]), radius });
+}
+
+// native bool:PRandZoneSetAddCylinder(PRandZoneSet:set, Float:baseX, Float:baseY, Float:baseZ, Float:radius, Float:height);
+static cell AMX_NATIVE_CALL n_PRandZoneSetAddCylinder(AMX* amx, cell* params) {
+    float radius = amx_ctof(params[5]);
+    float height = amx_ctof(params[6]);
+    if (radius <= 0.0f || height <= 0.0f) return 0;
+    
+    return AddZone(amx, params[1], RandomixZones::Cylinder{ amx_ctof(params[2]), amx_ctof(params[3]), amx_ctof(params[4]), radius, height });
+}
+
+// native bool:PRandZoneSetAddCapsule(PRandZoneSet:set, Float:x1, Float:y1, Float:z1, Float:x2, Float:y2, Float:z2, Float:radius);
+static cell AMX_NATIVE_CALL n_PRandZoneSetAddCapsule(AMX* amx, cell* params) {
+    float radius = amx_ctof(params[8]);
+    if (radius <= 0.0f) return 0;
+    
+    return AddZone(amx, params[1], RandomixZones::Capsule(amx_ctof(params[2]), amx_ctof(params[3]), amx_ctof(params[4]),
+        amx_ctof(params[5]), amx_ctof(params[6]), amx_ctof(params[7]), radius));
+}
+
+// native bool:PRandZoneSetPoint(PRandZoneSet:set, &Float:x, &Float:y, &Float:z);
+static cell AMX_NATIVE_CALL n_PRandZoneSetPoint(AMX* amx, cell* params) {
+    const ZoneSet* set = RandomixGenerators::GetContext(amx).zone_sets.get(static_cast<int>(params[1]));
+    if (!set || set->size() == 0) return 0;
+    
+    cell *outX, *outY, *outZ;
+    amx_GetAddr(amx, params[2], &outX);
+    amx_GetAddr(amx, params[3], &outY);
+    amx_GetAddr(amx, params[4], &outZ);
+    if (!outX || !outY || !outZ) return 0;
+    
+    RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        set->sample(rng, *reinterpret_cast<float*>(outX), *reinterpret_cast<float*>(outY),
+            *reinterpret_cast<float*>(outZ));
+    });
+    return 1;
+}
+
+// native bool:PRandZoneSetPoints(PRandZoneSet:set, Float:x[], Float:y[], Float:z[], count = sizeof x);
+static cell AMX_NATIVE_CALL n_PRandZoneSetPoints(AMX* amx, cell* params) {
+    int count = static_cast<int>(params[5]);
+    if (count <= 0) return 0;
+    
+    const ZoneSet* set = RandomixGenerators::GetContext(amx).zone_sets.get(static_cast<int>(params[1]));
+    if (!set || set->size() == 0) return 0;
+    
+    cell* outX = GetArrayAddress(amx, params[2]);
+    cell* outY = GetArrayAddress(amx, params[3]);
+    cell* outZ = GetArrayAddress(amx, params[4]);
+    if (!outX || !outY || !outZ) return 0;
+    
+    float* xs = reinterpret_cast<float*>(outX);
+    float* ys = reinterpret_cast<float*>(outY);
+    float* zs = reinterpret_cast<float*>(outZ);
+    RandomixGenerators::VisitPRNG(amx, [&](auto& rng) {
+        for (int i = 0; i < count; i++) {
+            set->sample(rng, xs[i], ys[i], zs[i]);
+        }
+    });
+    return 1;
+}
+
+// native bool:PRandZoneSetContains(PRandZoneSet:set, Float:x, Float:y, Float:z);
+static cell AMX_NATIVE_CALL n_PRandZoneSetContains(AMX* amx, cell* params) {
+    const ZoneSet* set = RandomixGenerators::GetContext(amx).zone_sets.get(static_cast<int>(params[1]));
+    return set && set->contains(amx_ctof(params[2]), amx_ctof(params[3]), amx_ctof(params[4])) ? 1 : 0;
+}
+
+// native bool:PRandZoneSetDestroy(PRandZoneSet:set);
+static cell AMX_NATIVE_CALL n_PRandZoneSetDestroy(AMX* amx, cell* params) {
+    return RandomixGenerators::GetContext(amx).zone_sets.remove(static_cast<int>(params[1])) ? 1 : 0;
+}
+
+// ============================================================================
+// NATIVE FUNCTIONS TABLE - DIPERBARUI DENGAN NATIVE BARU
+// ============================================================================
+
+static const AMX_NATIVE_INFO native_list[] = {
+    // Range Functions
+    {"PRandRange", n_PRandRange},
+    {"CSPRandRange", n_CSPRandRange},
+    {"PRandFloatRange", n_PRandFloatRange},
+    {"CSPRandFloatRange", n_CSPRandFloatRange},
+    
+    // Seed Functions
+    {"SeedPRNG", n_SeedPRNG},
+    {"SeedPRNGStream", n_SeedPRNGStream},
+    {"PRandAdvance", n_PRandAdvance},
+    {"PRandBackstep", n_PRandBackstep},
+    {"PRandSetEngine", n_PRandSetEngine},
+    {"PRandGetEngine", n_PRandGetEngine},
+    {"SeedCSPRNG", n_SeedCSPRNG},
+    {"CSPRandSetRounds", n_CSPRandSetRounds},
+    {"CSPRandGetRounds", n_CSPRandGetRounds},
+    
+    // Boolean Functions
+    {"PRandBool", n_PRandBool},
+    {"CSPRandBool", n_CSPRandBool},
+    {"PRandBoolWeighted", n_PRandBoolWeighted},
+    
+    // Array Functions
+    {"PRandWeighted", n_PRandWeighted},
+    {"PRandShuffle", n_PRandShuffle},
+    {"PRandShuffleRange", n_PRandShuffleRange},
+    {"PRandWeightedSample", n_PRandWeightedSample},
+    {"PRandWeightedShuffle", n_PRandWeightedShuffle},
+    {"PRandSample", n_PRandSample},
+    {"PRandFill", n_PRandFill},
+    {"PRandFloatFill", n_PRandFloatFill},
+    {"CSPRandFill", n_CSPRandFill},
+    {"CSPRandFloatFill", n_CSPRandFloatFill},
+    
+    // Distribution Functions
+    {"PRandGaussian", n_PRandGaussian},
+    {"PRandGaussianFloat", n_PRandGaussianFloat},
+    {"PRandGaussianClamped", n_PRandGaussianClamped},
+    {"PRandGaussianFill", n_PRandGaussianFill},
+    {"PRandGaussianFillClamped", n_PRandGaussianFillClamped},
+    {"PRandDice", n_PRandDice},
+    
+    // Cryptographic Functions
+    {"CSPRandToken", n_CSPRandToken},
+    {"CSPRandBytes", n_CSPRandBytes},
+    {"CSPRandBytesPacked", n_CSPRandBytesPacked},
+    {"CSPRandHex", n_CSPRandHex},
+    {"CSPRandBase64", n_CSPRandBase64},
+    {"CSPRandUUID", n_CSPRandUUID},
+    
+    // 64-bit Functions
+    {"PRand64", n_PRand64},
+    {"PRandBounded64", n_PRandBounded64},
+    {"PRand64Fill", n_PRand64Fill},
+    {"PRandDouble", n_PRandDouble},
+    
+    // Keyed Functions
+    {"PRandKeyed", n_PRandKeyed},
+    {"PRandKeyedRange", n_PRandKeyedRange},
+    {"PRandKeyedFloat", n_PRandKeyedFloat},
+    {"PRandKeyedFill", n_PRandKeyedFill},
+    {"PRandKeyedRangeFill", n_PRandKeyedRangeFill},
+    {"PRandKeyedFloatFill", n_PRandKeyedFloatFill},
+    
+    // =============== NEW 2D POINT FUNCTIONS ===============
+    {"PRandPointInCircle", n_PRandPointInCircle},
+    {"CSPRandPointInCircle", n_CSPRandPointInCircle},
+    {"PRandPointOnCircle", n_PRandPointOnCircle},
+    {"PRandPointInRect", n_PRandPointInRect},
+    {"PRandPointInRing", n_PRandPointInRing},
+    {"PRandPointInEllipse", n_PRandPointInEllipse},
+    {"PRandPointInTriangle", n_PRandPointInTriangle},
+    
+    // =============== NEW 3D POINT FUNCTIONS ===============
+    {"PRandPointInSphere", n_PRandPointInSphere},
+    {"CSPRandPointInSphere", n_CSPRandPointInSphere},
+    {"PRandPointOnSphere", n_PRandPointOnSphere},
+    {"PRandPointInBox", n_PRandPointInBox},
+    
+    // =============== NEW ADVANCED GEOMETRIC FUNCTION ===============
+    {"PRandPointInPolygon", n_PRandPointInPolygon},
+    
+    // =============== BATCH POINT FUNCTIONS ===============
+    {"PRandPointsInCircle", n_PRandPointsInCircle},
+    {"PRandPointsOnCircle", n_PRandPointsOnCircle},
+    {"PRandPointsInRing", n_PRandPointsInRing},
+    {"PRandPointsInEllipse", n_PRandPointsInEllipse},
+    {"PRandPointsInRect", n_PRandPointsInRect},
+    {"PRandPointsInSphere", n_PRandPointsInSphere},
+    {"PRandPointsOnSphere", n_PRandPointsOnSphere},
+    {"PRandPointsInBox", n_PRandPointsInBox},
+    
+    // =============== ALIAS TABLE FUNCTIONS ===============
+    {"PRandAliasCreate", n_PRandAliasCreate},
+    {"PRandAliasPick", n_PRandAliasPick},
+    {"PRandAliasPickMany", n_PRandAliasPickMany},
+    {"PRandAliasDestroy", n_PRandAliasDestroy},
+    
+    // =============== WEIGHTED SET FUNCTIONS ===============
+    {"PRandWeightedSetCreate", n_PRandWeightedSetCreate},
+    {"PRandWeightedSetFromArray", n_PRandWeightedSetFromArray},
+    {"PRandWeightedSetSetWeight", n_PRandWeightedSetSetWeight},
+    {"PRandWeightedSetGetWeight", n_PRandWeightedSetGetWeight},
+    {"PRandWeightedSetPick", n_PRandWeightedSetPick},
+    {"PRandWeightedSetPickAndRemove", n_PRandWeightedSetPickAndRemove},
+    {"PRandWeightedSetDestroy", n_PRandWeightedSetDestroy},
+    
+    // =============== DECK FUNCTIONS ===============
+    {"PRandDeckCreate", n_PRandDeckCreate},
+    {"PRandDeckDraw", n_PRandDeckDraw},
+    {"PRandDeckDrawMany", n_PRandDeckDrawMany},
+    {"PRandDeckShuffle", n_PRandDeckShuffle},
+    {"PRandDeckRemaining", n_PRandDeckRemaining},
+    {"PRandDeckSetCut", n_PRandDeckSetCut},
+    {"PRandDeckCutReached", n_PRandDeckCutReached},
+    {"PRandDeckSetAutoShuffle", n_PRandDeckSetAutoShuffle},
+    {"PRandDeckDestroy", n_PRandDeckDestroy},
+    
+    // =============== PERMUTATION FUNCTIONS ===============
+    {"PRandPermCreate", n_PRandPermCreate},
+    {"PRandPermGet", n_PRandPermGet},
+    {"PRandPermInverse", n_PRandPermInverse},
+    {"PRandPermDestroy", n_PRandPermDestroy},
+    
+    // =============== DICE EXPRESSION FUNCTIONS ===============
+    {"PRandDiceRoll", n_PRandDiceRoll},
+    {"PRandDiceCompile", n_PRandDiceCompile},
+    {"PRandDiceEval", n_PRandDiceEval},
+    {"PRandDiceEvalMany", n_PRandDiceEvalMany},
+    {"PRandDiceFree", n_PRandDiceFree},
+    
+    // =============== POLYGON FUNCTIONS ===============
+    {"PRandPolygonCreate", n_PRandPolygonCreate},
+    {"PRandPolygonAddHole", n_PRandPolygonAddHole},
+    {"PRandPolygonPoint", n_PRandPolygonPoint},
+    {"PRandPolygonPoints", n_PRandPolygonPoints},
+    {"PRandPolygonArea", n_PRandPolygonArea},
+    {"PRandPolygonDestroy", n_PRandPolygonDestroy},
+    
+    // =============== POISSON-DISC FUNCTIONS ===============
+    {"PRandPoissonRect", n_PRandPoissonRect},
+    {"PRandPoissonCircle", n_PRandPoissonCircle},
+    {"PRandPoissonPolygon", n_PRandPoissonPolygon},
+    
+    // =============== POLYLINE FUNCTIONS ===============
+    {"PRandPolylineCreate", n_PRandPolylineCreate},
+    {"PRandPolylineAppend", n_PRandPolylineAppend},
+    {"PRandPolylinePoint", n_PRandPolylinePoint},
+    {"PRandPolylinePoints", n_PRandPolylinePoints},
+    {"PRandPolylineAt", n_PRandPolylineAt},
+    {"PRandPolylineLength", n_PRandPolylineLength},
+    {"PRandPolylineDestroy", n_PRandPolylineDestroy},
+    
+    // =============== ZONE SET FUNCTIONS ===============
+    {"PRandZoneSetCreate", n_PRandZoneSetCreate},
+    {"PRandZoneSetAddBox", n_PRandZoneSetAddBox},
+    {"PRandZoneSetAddOrientedBox", n_PRandZoneSetAddOrientedBox},
+    {"PRandZoneSetAddSphere", n_PRandZoneSetAddSphere},
+    {"PRandZoneSetAddCylinder", n_PRandZoneSetAddCylinder},
+    {"PRandZoneSetAddCapsule", n_PRandZoneSetAddCapsule},
+    {"PRandZoneSetPoint", n_PRandZoneSetPoint},
+    {"PRandZoneSetPoints", n_PRandZoneSetPoints},
+    {"PRandZoneSetContains", n_PRandZoneSetContains},
+    {"PRandZoneSetDestroy", n_PRandZoneSetDestroy},
     
     {NULL, NULL}
 };
 
 // Register natives
 PLUGIN_EXPORT int PLUGIN_CALL AmxLoad(AMX *amx) {
+    RandomixGenerators::CreateContext(amx);
     return amx_Register(amx, native_list, -1);
 }
 
 PLUGIN_EXPORT int PLUGIN_CALL AmxUnload(AMX *amx) {
+    RandomixGenerators::DestroyContext(amx);
     return AMX_ERR_NONE;
 }
\ No newline at end of file
@@ -3,6 +3,9 @@
 #include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <limits>
+#include <atomic>
+#include <unordered_map>
 
 // OS-specific headers for system entropy
 #ifdef _WIN32
@@ -16,6 +19,23 @@
     #include <fcntl.h>
 #endif
 
+// x86 SIMD kernels are compiled per function and picked at runtime
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+    #define RANDOMIX_X86 1
+    #ifdef _MSC_VER
+        #include <intrin.h>
+    #endif
+    #include <immintrin.h>
+#else
+    #define RANDOMIX_X86 0
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define RANDOMIX_TARGET(isa) __attribute__((target(isa)))
+#else
+    #define RANDOMIX_TARGET(isa)
+#endif
+
 // PCG32 Implementation
 PCG32::PCG32(uint64_t seed) {
     if (seed == 0) {
@@ -24,65 +44,2002 @@ PCG32::PCG32(uint64_t seed) {
         );
     }
     
-    state = 0;
-    inc = (INCREMENT << 1u) | 1u;
-    next_uint32();
-    state += seed;
-    next_uint32();
+    state = 0;
+    inc = (INCREMENT << 1u) | 1u;
+    next_uint32();
+    state += seed;
+    next_uint32();
+}
+
+PCG32::PCG32(uint64_t seed, uint64_t stream) {
+    this->seed(seed, stream);
+}
+
+void PCG32::seed(uint64_t seed) {
+    state = 0;
+    inc = (INCREMENT << 1u) | 1u;
+    next_uint32();
+    state += seed;
+    next_uint32();
+}
+
+void PCG32::seed(uint64_t seed, uint64_t stream) {
+    state = 0;
+    inc = (stream << 1u) | 1u;
+    next_uint32();
+    state += seed;
+    next_uint32();
+}
+
+// LCG jump-ahead (Brown, "Random Number Generation with Arbitrary Strides")
+void PCG32::advance(uint64_t delta) {
+    uint64_t cur_mult = MULTIPLIER;
+    uint64_t cur_plus = inc;
+    uint64_t acc_mult = 1u;
+    uint64_t acc_plus = 0u;
+    
+    while (delta > 0) {
+        if (delta & 1u) {
+            acc_mult *= cur_mult;
+            acc_plus = acc_plus * cur_mult + cur_plus;
+        }
+        cur_plus = (cur_mult + 1u) * cur_plus;
+        cur_mult *= cur_mult;
+        delta >>= 1u;
+    }
+    
+    state = acc_mult * state + acc_plus;
+}
+
+void PCG32::backstep(uint64_t delta) {
+    // The period is 2^64, so stepping back is advancing by -delta
+    advance(0u - delta);
+}
+
+uint32_t PCG32::next_uint32() {
+    uint64_t oldstate = state;
+    state = oldstate * MULTIPLIER + inc;
+    
+    uint32_t xorshifted = static_cast<uint32_t>(((oldstate >> 18u) ^ oldstate) >> 27u);
+    uint32_t rot = static_cast<uint32_t>(oldstate >> 59u);
+    
+    return (xorshifted >> rot) | (xorshifted << ((~rot + 1) & 31u));
+}
+
+float PCG32::next_float() {
+    return static_cast<float>(next_uint32()) / 4294967296.0f;
+}
+
+void PCG32::fill(uint32_t* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = next_uint32();
+    }
+}
+
+uint64_t PCG32::next_uint64() {
+    uint64_t hi = next_uint32();
+    return (hi << 32) | next_uint32();
+}
+
+uint32_t PCG32::next_bounded(uint32_t bound) {
+    if (bound == 0) return 0;
+    
+    uint64_t m = static_cast<uint64_t>(next_uint32()) * static_cast<uint64_t>(bound);
+    uint32_t leftover = static_cast<uint32_t>(m);
+    
+    if (leftover < bound) {
+        uint32_t threshold = (0u - bound) % bound;
+        while (leftover < threshold) {
+            m = static_cast<uint64_t>(next_uint32()) * static_cast<uint64_t>(bound);
+            leftover = static_cast<uint32_t>(m);
+        }
+    }
+    
+    return static_cast<uint32_t>(m >> 32);
+}
+
+namespace {
+    // SplitMix64, expands one seed into well-spread state words
+    uint64_t splitmix64(uint64_t& x) {
+        uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+    
+    uint64_t time_seed() {
+        return static_cast<uint64_t>(
+            std::chrono::system_clock::now().time_since_epoch().count()
+        );
+    }
+    
+    // Stream ids fold into the seed for engines without a native stream
+    uint64_t stream_seed(uint64_t seed, uint64_t stream) {
+        uint64_t x = stream ^ 0x6A09E667F3BCC909ULL;
+        return seed ^ splitmix64(x);
+    }
+    
+    inline uint64_t rotl64(uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+    
+    // 64x64 -> 128-bit multiply, returns the low half
+    inline uint64_t mul_64x64(uint64_t a, uint64_t b, uint64_t& hi) {
+#if defined(__SIZEOF_INT128__)
+        unsigned __int128 p = static_cast<unsigned __int128>(a) * b;
+        hi = static_cast<uint64_t>(p >> 64);
+        return static_cast<uint64_t>(p);
+#else
+        uint64_t a_lo = a & 0xFFFFFFFFu, a_hi = a >> 32;
+        uint64_t b_lo = b & 0xFFFFFFFFu, b_hi = b >> 32;
+        
+        uint64_t p0 = a_lo * b_lo;
+        uint64_t p1 = a_lo * b_hi;
+        uint64_t p2 = a_hi * b_lo;
+        uint64_t p3 = a_hi * b_hi;
+        
+        uint64_t mid = (p0 >> 32) + (p1 & 0xFFFFFFFFu) + (p2 & 0xFFFFFFFFu);
+        hi = p3 + (p1 >> 32) + (p2 >> 32) + (mid >> 32);
+        return (mid << 32) | (p0 & 0xFFFFFFFFu);
+#endif
+    }
+}
+
+// PCG64-DXSM Implementation
+PCG64::PCG64(uint64_t seed) {
+    if (seed == 0) {
+        seed = static_cast<uint64_t>(
+            std::chrono::system_clock::now().time_since_epoch().count()
+        );
+    }
+    
+    this->seed(seed, STREAM);
+}
+
+PCG64::PCG64(uint64_t seed, uint64_t stream) {
+    this->seed(seed, stream);
+}
+
+void PCG64::seed(uint64_t seed) {
+    this->seed(seed, STREAM);
+}
+
+void PCG64::seed(uint64_t seed, uint64_t stream) {
+    state_hi = 0;
+    state_lo = 0;
+    inc_hi = stream >> 63;
+    inc_lo = (stream << 1u) | 1u;
+    step();
+    
+    uint64_t lo = state_lo + seed;
+    state_hi += (lo < state_lo) ? 1u : 0u;
+    state_lo = lo;
+    step();
+}
+
+// state = state * CHEAP_MULTIPLIER + inc (mod 2^128)
+void PCG64::step() {
+    uint64_t carry_hi;
+    uint64_t lo = mul_64x64(state_lo, CHEAP_MULTIPLIER, carry_hi);
+    uint64_t hi = state_hi * CHEAP_MULTIPLIER + carry_hi;
+    
+    state_lo = lo + inc_lo;
+    state_hi = hi + inc_hi + ((state_lo < lo) ? 1u : 0u);
+}
+
+uint64_t PCG64::next_uint64() {
+    // DXSM output on the pre-step state
+    uint64_t hi = state_hi;
+    uint64_t lo = state_lo | 1u;
+    
+    hi ^= hi >> 32;
+    hi *= CHEAP_MULTIPLIER;
+    hi ^= hi >> 48;
+    hi *= lo;
+    
+    step();
+    return hi;
+}
+
+uint32_t PCG64::next_uint32() {
+    return static_cast<uint32_t>(next_uint64() >> 32);
+}
+
+float PCG64::next_float() {
+    return static_cast<float>(next_uint64() >> 40) / 16777216.0f;
+}
+
+double PCG64::next_double() {
+    return static_cast<double>(next_uint64() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+uint32_t PCG64::next_bounded(uint32_t bound) {
+    if (bound == 0) return 0;
+    
+    uint64_t m = static_cast<uint64_t>(next_uint32()) * static_cast<uint64_t>(bound);
+    uint32_t leftover = static_cast<uint32_t>(m);
+    
+    if (leftover < bound) {
+        uint32_t threshold = (0u - bound) % bound;
+        while (leftover < threshold) {
+            m = static_cast<uint64_t>(next_uint32()) * static_cast<uint64_t>(bound);
+            leftover = static_cast<uint32_t>(m);
+        }
+    }
+    
+    return static_cast<uint32_t>(m >> 32);
+}
+
+uint64_t PCG64::next_bounded64(uint64_t bound) {
+    if (bound == 0) return 0;
+    
+    uint64_t hi;
+    uint64_t leftover = mul_64x64(next_uint64(), bound, hi);
+    
+    if (leftover < bound) {
+        uint64_t threshold = (0u - bound) % bound;
+        while (leftover < threshold) {
+            leftover = mul_64x64(next_uint64(), bound, hi);
+        }
+    }
+    
+    return hi;
+}
+
+// xoshiro256++ Implementation
+Xoshiro256pp::Xoshiro256pp(uint64_t seed) {
+    this->seed(seed == 0 ? time_seed() : seed);
+}
+
+void Xoshiro256pp::seed(uint64_t seed) {
+    for (int i = 0; i < 4; ++i) {
+        s[i] = splitmix64(seed);
+    }
+}
+
+void Xoshiro256pp::seed(uint64_t seed, uint64_t stream) {
+    this->seed(stream_seed(seed, stream));
+}
+
+uint64_t Xoshiro256pp::next_uint64() {
+    uint64_t result = rotl64(s[0] + s[3], 23) + s[0];
+    uint64_t t = s[1] << 17;
+    
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl64(s[3], 45);
+    
+    return result;
+}
+
+// SFC64 Implementation
+SFC64::SFC64(uint64_t seed) {
+    this->seed(seed == 0 ? time_seed() : seed);
+}
+
+void SFC64::seed(uint64_t seed) {
+    a = b = c = seed;
+    counter = 1;
+    for (int i = 0; i < 12; ++i) {
+        next_uint64();
+    }
+}
+
+void SFC64::seed(uint64_t seed, uint64_t stream) {
+    this->seed(stream_seed(seed, stream));
+}
+
+uint64_t SFC64::next_uint64() {
+    uint64_t tmp = a + b + counter++;
+    a = b ^ (b >> 11);
+    b = c + (c << 3);
+    c = rotl64(c, 24) + tmp;
+    return tmp;
+}
+
+// wyrand Implementation
+WyRand::WyRand(uint64_t seed) {
+    this->seed(seed == 0 ? time_seed() : seed);
+}
+
+void WyRand::seed(uint64_t seed) {
+    state = seed;
+}
+
+void WyRand::seed(uint64_t seed, uint64_t stream) {
+    this->seed(stream_seed(seed, stream));
+}
+
+uint64_t WyRand::next_uint64() {
+    state += 0xa0761d6478bd642fULL;
+    uint64_t hi;
+    uint64_t lo = mul_64x64(state, state ^ 0xe7037ed1a0b428dbULL, hi);
+    return hi ^ lo;
+}
+
+// Runtime SIMD dispatch, shared by the PCG32x8 and ChaCha kernels
+#if RANDOMIX_X86
+namespace {
+    enum SimdLevel {
+        SIMD_NONE,
+        SIMD_SSE2,
+        SIMD_AVX2,
+        SIMD_AVX512
+    };
+    
+    SimdLevel detect_simd() {
+#if defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        int max_leaf = info[0];
+        
+        __cpuid(info, 1);
+        bool sse2 = (info[3] & (1 << 26)) != 0;
+        bool osxsave = (info[2] & (1 << 27)) != 0;
+        unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+        
+        bool avx2 = false, avx512 = false;
+        if (max_leaf >= 7) {
+            __cpuidex(info, 7, 0);
+            avx2 = (info[1] & (1 << 5)) != 0 && (xcr0 & 0x06) == 0x06;
+            avx512 = (info[1] & (1 << 16)) != 0 && (xcr0 & 0xE6) == 0xE6;
+        }
+        
+        if (avx512) return SIMD_AVX512;
+        if (avx2) return SIMD_AVX2;
+        if (sse2) return SIMD_SSE2;
+        return SIMD_NONE;
+#else
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) return SIMD_AVX512;
+        if (__builtin_cpu_supports("avx2")) return SIMD_AVX2;
+        if (__builtin_cpu_supports("sse2")) return SIMD_SSE2;
+        return SIMD_NONE;
+#endif
+    }
+    
+    SimdLevel simd_level() {
+        static const SimdLevel level = detect_simd();
+        return level;
+    }
+}
+#endif
+
+// PCG32x8 Implementation
+// The buffer holds 128 steps of all 8 lanes interleaved (word i belongs to
+// lane i % 8); the AVX2 and scalar refills produce identical buffers.
+namespace {
+    constexpr uint64_t PCG_MULTIPLIER = 6364136223846793005ULL;
+    
+    inline uint32_t pcg_output(uint64_t old) {
+        uint32_t xorshifted = static_cast<uint32_t>(((old >> 18u) ^ old) >> 27u);
+        uint32_t rot = static_cast<uint32_t>(old >> 59u);
+        return (xorshifted >> rot) | (xorshifted << ((0u - rot) & 31));
+    }
+    
+    void pcg32x8_refill_scalar(uint64_t* state, const uint64_t* inc, uint32_t* out, int steps) {
+        for (int n = 0; n < steps; ++n, out += 8) {
+            for (int lane = 0; lane < 8; ++lane) {
+                uint64_t old = state[lane];
+                state[lane] = old * PCG_MULTIPLIER + inc[lane];
+                out[lane] = pcg_output(old);
+            }
+        }
+    }
+    
+#if RANDOMIX_X86
+    // AVX2 has no 64-bit multiply, so the low half is built from three
+    // 32x32 products; the 32-bit rotate uses per-lane variable shifts
+    RANDOMIX_TARGET("avx2")
+    inline __m256i pcg_step_avx2(__m256i& s, __m256i inc, __m256i mul_lo, __m256i mul_hi) {
+        __m256i old = s;
+        __m256i lo = _mm256_mul_epu32(old, mul_lo);
+        __m256i cross = _mm256_add_epi64(
+            _mm256_mul_epu32(_mm256_srli_epi64(old, 32), mul_lo),
+            _mm256_mul_epu32(old, mul_hi));
+        s = _mm256_add_epi64(_mm256_add_epi64(lo, _mm256_slli_epi64(cross, 32)), inc);
+        
+        __m256i x = _mm256_srli_epi64(_mm256_xor_si256(_mm256_srli_epi64(old, 18), old), 27);
+        x = _mm256_and_si256(x, _mm256_set1_epi64x(0xFFFFFFFF));
+        __m256i rot = _mm256_srli_epi64(old, 59);
+        // Only the low 32 bits of each lane are kept, so a shift by 32 is harmless
+        return _mm256_or_si256(
+            _mm256_srlv_epi64(x, rot),
+            _mm256_sllv_epi64(x, _mm256_sub_epi64(_mm256_set1_epi64x(32), rot)));
+    }
+    
+    // Each lane runs as 4 interleaved phases that jump 4 steps at a time, so
+    // the multiply latency of one phase hides behind the other three
+    RANDOMIX_TARGET("avx2")
+    void pcg32x8_refill_avx2(uint64_t* state, const uint64_t* inc, uint32_t* out, int steps) {
+        constexpr uint64_t M2 = PCG_MULTIPLIER * PCG_MULTIPLIER;
+        constexpr uint64_t M4 = M2 * M2;
+        const __m256i mul_lo = _mm256_set1_epi64x(static_cast<int64_t>(M4 & 0xFFFFFFFF));
+        const __m256i mul_hi = _mm256_set1_epi64x(static_cast<int64_t>(M4 >> 32));
+        
+        alignas(32) uint64_t phase[4][8];
+        alignas(32) uint64_t inc4[8];
+        for (int lane = 0; lane < 8; ++lane) {
+            uint64_t s = state[lane];
+            for (int p = 0; p < 4; ++p) {
+                phase[p][lane] = s;
+                s = s * PCG_MULTIPLIER + inc[lane];
+            }
+            inc4[lane] = inc[lane] * (1 + PCG_MULTIPLIER + M2 + M2 * PCG_MULTIPLIER);
+        }
+        
+        __m256i s[8];
+        for (int p = 0; p < 4; ++p) {
+            s[2 * p] = _mm256_load_si256(reinterpret_cast<const __m256i*>(phase[p]));
+            s[2 * p + 1] = _mm256_load_si256(reinterpret_cast<const __m256i*>(phase[p] + 4));
+        }
+        const __m256i inc0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(inc4));
+        const __m256i inc1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(inc4 + 4));
+        
+        for (int n = 0; n < steps; n += 4) {
+            for (int p = 0; p < 4; ++p, out += 8) {
+                __m256i r0 = pcg_step_avx2(s[2 * p], inc0, mul_lo, mul_hi);
+                __m256i r1 = pcg_step_avx2(s[2 * p + 1], inc1, mul_lo, mul_hi);
+                
+                // Gather the low words back into lane order 0..7
+                __m256i packed = _mm256_castps_si256(_mm256_shuffle_ps(
+                    _mm256_castsi256_ps(r0), _mm256_castsi256_ps(r1), _MM_SHUFFLE(2, 0, 2, 0)));
+                packed = _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0));
+                _mm256_store_si256(reinterpret_cast<__m256i*>(out), packed);
+            }
+        }
+        
+        // Phase 0 has moved exactly `steps` steps ahead
+        _mm256_store_si256(reinterpret_cast<__m256i*>(state), s[0]);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(state + 4), s[1]);
+    }
+#endif
+}
+
+PCG32x8::PCG32x8(uint64_t seed) {
+    this->seed(seed == 0 ? time_seed() : seed);
+}
+
+void PCG32x8::seed(uint64_t seed) {
+    this->seed(seed, 0);
+}
+
+void PCG32x8::seed(uint64_t seed, uint64_t stream) {
+    // Each lane gets its own odd increment and a SplitMix64 initial state
+    uint64_t sm = seed;
+    for (int lane = 0; lane < LANES; ++lane) {
+        inc[lane] = (((stream << 3) + lane) << 1u) | 1u;
+        state[lane] = 0;
+        state[lane] = state[lane] * PCG_MULTIPLIER + inc[lane];
+        state[lane] += splitmix64(sm);
+        state[lane] = state[lane] * PCG_MULTIPLIER + inc[lane];
+    }
+    position = BUFFER_WORDS;
+}
+
+void PCG32x8::fill(uint32_t* out, size_t count) {
+    // Whole buffer runs are copied rather than popped word by word
+    while (count > 0) {
+        if (position >= BUFFER_WORDS) refill();
+        
+        size_t n = std::min(count, static_cast<size_t>(BUFFER_WORDS - position));
+        std::memcpy(out, buffer + position, n * sizeof(uint32_t));
+        position += static_cast<int>(n);
+        out += n;
+        count -= n;
+    }
+}
+
+void PCG32x8::refill() {
+#if RANDOMIX_X86
+    if (simd_level() >= SIMD_AVX2) {
+        pcg32x8_refill_avx2(state, inc, buffer, BUFFER_WORDS / LANES);
+        position = 0;
+        return;
+    }
+#endif
+    pcg32x8_refill_scalar(state, inc, buffer, BUFFER_WORDS / LANES);
+    position = 0;
+}
+
+// Philox4x32-10 Implementation
+// Blocks are computed one per SIMD lane and transposed back, so the AVX2
+// path is bit-exact with the scalar one.
+namespace {
+    constexpr uint32_t PHILOX_M0 = 0xD2511F53;
+    constexpr uint32_t PHILOX_M1 = 0xCD9E8D57;
+    constexpr uint32_t PHILOX_W0 = 0x9E3779B9;
+    constexpr uint32_t PHILOX_W1 = 0xBB67AE85;
+    constexpr int PHILOX_ROUNDS = 10;
+    
+    inline Philox4x32::Block philox_block(uint64_t key, uint64_t counter, uint64_t block) {
+        uint32_t x0 = static_cast<uint32_t>(counter);
+        uint32_t x1 = static_cast<uint32_t>(counter >> 32);
+        uint32_t x2 = static_cast<uint32_t>(block);
+        uint32_t x3 = static_cast<uint32_t>(block >> 32);
+        uint32_t k0 = static_cast<uint32_t>(key);
+        uint32_t k1 = static_cast<uint32_t>(key >> 32);
+        
+        for (int r = 0; r < PHILOX_ROUNDS; ++r) {
+            uint64_t p0 = static_cast<uint64_t>(PHILOX_M0) * x0;
+            uint64_t p1 = static_cast<uint64_t>(PHILOX_M1) * x2;
+            
+            x0 = static_cast<uint32_t>(p1 >> 32) ^ x1 ^ k0;
+            x1 = static_cast<uint32_t>(p1);
+            x2 = static_cast<uint32_t>(p0 >> 32) ^ x3 ^ k1;
+            x3 = static_cast<uint32_t>(p0);
+            
+            k0 += PHILOX_W0;
+            k1 += PHILOX_W1;
+        }
+        
+        return {x0, x1, x2, x3};
+    }
+    
+    // Rejected candidates for word `index` come from the top half of the
+    // block space, which fill() never reaches
+    constexpr uint64_t PHILOX_RETRY = 1ULL << 63;
+    
+    uint32_t philox_retry(uint64_t key, uint64_t counter, uint64_t index, uint32_t bound) {
+        uint32_t threshold = (0u - bound) % bound;
+        uint64_t block = PHILOX_RETRY | (index << 2);
+        
+        for (;;) {
+            Philox4x32::Block b = philox_block(key, counter, block++);
+            for (uint32_t w : b) {
+                uint64_t m = static_cast<uint64_t>(w) * bound;
+                if (static_cast<uint32_t>(m) >= threshold) {
+                    return static_cast<uint32_t>(m >> 32);
+                }
+            }
+        }
+    }
+    
+#if RANDOMIX_X86
+    // 32x32 -> 64 products of all 8 lanes, split into low and high words
+    RANDOMIX_TARGET("avx2")
+    inline void philox_mulhilo_avx2(__m256i x, __m256i m, __m256i& lo, __m256i& hi) {
+        __m256i even = _mm256_mul_epu32(x, m);
+        __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(x, 32), m);
+        lo = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+        hi = _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+    }
+    
+    // 8 consecutive blocks starting at `block`, written as 32 words
+    RANDOMIX_TARGET("avx2")
+    void philox_blocks_avx2(uint64_t key, uint64_t counter, uint64_t block, uint32_t* out) {
+        alignas(32) uint32_t lo[8], hi[8];
+        for (int i = 0; i < 8; ++i) {
+            lo[i] = static_cast<uint32_t>(block + i);
+            hi[i] = static_cast<uint32_t>((block + i) >> 32);
+        }
+        
+        const __m256i m0 = _mm256_set1_epi32(static_cast<int>(PHILOX_M0));
+        const __m256i m1 = _mm256_set1_epi32(static_cast<int>(PHILOX_M1));
+        __m256i x0 = _mm256_set1_epi32(static_cast<int>(static_cast<uint32_t>(counter)));
+        __m256i x1 = _mm256_set1_epi32(static_cast<int>(static_cast<uint32_t>(counter >> 32)));
+        __m256i x2 = _mm256_load_si256(reinterpret_cast<const __m256i*>(lo));
+        __m256i x3 = _mm256_load_si256(reinterpret_cast<const __m256i*>(hi));
+        uint32_t k0 = static_cast<uint32_t>(key);
+        uint32_t k1 = static_cast<uint32_t>(key >> 32);
+        
+        for (int r = 0; r < PHILOX_ROUNDS; ++r) {
+            __m256i lo0, hi0, lo1, hi1;
+            philox_mulhilo_avx2(x0, m0, lo0, hi0);
+            philox_mulhilo_avx2(x2, m1, lo1, hi1);
+            
+            x0 = _mm256_xor_si256(_mm256_xor_si256(hi1, x1), _mm256_set1_epi32(static_cast<int>(k0)));
+            x1 = lo1;
+            x2 = _mm256_xor_si256(_mm256_xor_si256(hi0, x3), _mm256_set1_epi32(static_cast<int>(k1)));
+            x3 = lo0;
+            
+            k0 += PHILOX_W0;
+            k1 += PHILOX_W1;
+        }
+        
+        // Transpose 4 words x 8 lanes back into block order
+        __m256i t0 = _mm256_unpacklo_epi32(x0, x1);
+        __m256i t1 = _mm256_unpackhi_epi32(x0, x1);
+        __m256i t2 = _mm256_unpacklo_epi32(x2, x3);
+        __m256i t3 = _mm256_unpackhi_epi32(x2, x3);
+        __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+        __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+        __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+        __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+        
+        __m256i* dst = reinterpret_cast<__m256i*>(out);
+        _mm256_storeu_si256(dst + 0, _mm256_permute2x128_si256(u0, u1, 0x20));
+        _mm256_storeu_si256(dst + 1, _mm256_permute2x128_si256(u2, u3, 0x20));
+        _mm256_storeu_si256(dst + 2, _mm256_permute2x128_si256(u0, u1, 0x31));
+        _mm256_storeu_si256(dst + 3, _mm256_permute2x128_si256(u2, u3, 0x31));
+    }
+#endif
+}
+
+Philox4x32::Block Philox4x32::generate(uint64_t key, uint64_t counter, uint64_t block) {
+    return philox_block(key, counter, block);
+}
+
+uint32_t Philox4x32::word(uint64_t key, uint64_t counter, uint64_t index) {
+    return philox_block(key, counter, index >> 2)[index & 3];
+}
+
+float Philox4x32::word_float(uint64_t key, uint64_t counter, uint64_t index) {
+    return static_cast<float>(word(key, counter, index) >> 8) / 16777216.0f;
+}
+
+uint32_t Philox4x32::bounded(uint64_t key, uint64_t counter, uint64_t index, uint32_t bound) {
+    if (bound == 0) return 0;
+    
+    uint64_t m = static_cast<uint64_t>(word(key, counter, index)) * bound;
+    if (static_cast<uint32_t>(m) < bound && static_cast<uint32_t>(m) < (0u - bound) % bound) {
+        return philox_retry(key, counter, index, bound);
+    }
+    return static_cast<uint32_t>(m >> 32);
+}
+
+void Philox4x32::fill(uint32_t* out, size_t count, uint64_t key, uint64_t counter) {
+    uint64_t block = 0;
+    
+#if RANDOMIX_X86
+    if (simd_level() >= SIMD_AVX2) {
+        for (; count >= 32; count -= 32, block += 8, out += 32) {
+            philox_blocks_avx2(key, counter, block, out);
+        }
+    }
+#endif
+    
+    for (; count > 0; ++block) {
+        Block b = philox_block(key, counter, block);
+        size_t n = std::min<size_t>(count, 4);
+        std::copy(b.begin(), b.begin() + n, out);
+        out += n;
+        count -= n;
+    }
+}
+
+void Philox4x32::fill_bounded(uint32_t* out, size_t count, uint64_t key, uint64_t counter, uint32_t bound) {
+    fill(out, count, key, counter);
+    if (bound == 0) {
+        std::fill(out, out + count, 0);
+        return;
+    }
+    
+    // Same Lemire reduction as bounded(), word by word
+    uint32_t threshold = (0u - bound) % bound;
+    for (size_t i = 0; i < count; ++i) {
+        uint64_t m = static_cast<uint64_t>(out[i]) * bound;
+        if (static_cast<uint32_t>(m) < threshold) {
+            out[i] = philox_retry(key, counter, i, bound);
+        } else {
+            out[i] = static_cast<uint32_t>(m >> 32);
+        }
+    }
+}
+
+// RandomixGeometry Implementation
+// sin/cos come from a quadrant split of the turn fraction and short Taylor
+// polynomials, cbrt from a bit-level guess refined by Newton steps. The AVX2
+// versions use the same operations in the same order as the scalar helpers.
+namespace {
+    constexpr float GEO_HALF_PI = 1.57079632679f;
+    constexpr float GEO_INV_2_24 = 1.0f / 16777216.0f;
+    
+    constexpr float SIN_3 = -1.0f / 6.0f;
+    constexpr float SIN_5 = 1.0f / 120.0f;
+    constexpr float SIN_7 = -1.0f / 5040.0f;
+    constexpr float SIN_9 = 1.0f / 362880.0f;
+    constexpr float SIN_11 = -1.0f / 39916800.0f;
+    constexpr float COS_2 = -1.0f / 2.0f;
+    constexpr float COS_4 = 1.0f / 24.0f;
+    constexpr float COS_6 = -1.0f / 720.0f;
+    constexpr float COS_8 = 1.0f / 40320.0f;
+    constexpr float COS_10 = -1.0f / 3628800.0f;
+    constexpr float COS_12 = 1.0f / 479001600.0f;
+    constexpr uint32_t CBRT_MAGIC = 0x2A5137A0;
+    
+    // [0, 1) from the top 24 bits, exact in a float
+    inline float geo_unit(uint32_t w) {
+        return static_cast<float>(w >> 8) * GEO_INV_2_24;
+    }
+    
+    // sin and cos of u full turns, u in [0, 1)
+    inline void geo_sincos(float u, float& s, float& c) {
+        float t = u * 4.0f;
+        int q = static_cast<int>(t);
+        float a = (t - static_cast<float>(q)) * GEO_HALF_PI;
+        float a2 = a * a;
+        
+        float sp = a + a * (a2 * (SIN_3 + a2 * (SIN_5 + a2 * (SIN_7 + a2 * (SIN_9 + a2 * SIN_11)))));
+        float cp = 1.0f + a2 * (COS_2 + a2 * (COS_4 + a2 * (COS_6 + a2 * (COS_8 + a2 * (COS_10 + a2 * COS_12)))));
+        
+        switch (q & 3) {
+        case 0: s = sp; c = cp; break;
+        case 1: s = cp; c = -sp; break;
+        case 2: s = -sp; c = -cp; break;
+        default: s = -cp; c = sp; break;
+        }
+    }
+    
+    inline float geo_cbrt(float u) {
+        uint32_t bits;
+        std::memcpy(&bits, &u, sizeof(bits));
+        bits = bits / 3 + CBRT_MAGIC;
+        float y;
+        std::memcpy(&y, &bits, sizeof(y));
+        
+        for (int i = 0; i < 3; ++i) {
+            y = y - (y * y * y - u) / (3.0f * y * y);
+        }
+        return y;
+    }
+    
+#if RANDOMIX_X86
+    RANDOMIX_TARGET("avx2")
+    inline __m256 geo_unit_avx2(const uint32_t* w) {
+        __m256i bits = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w));
+        return _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(bits, 8)), _mm256_set1_ps(GEO_INV_2_24));
+    }
+    
+    RANDOMIX_TARGET("avx2")
+    inline void geo_sincos_avx2(__m256 u, __m256& s, __m256& c) {
+        __m256 t = _mm256_mul_ps(u, _mm256_set1_ps(4.0f));
+        __m256i q = _mm256_cvttps_epi32(t);
+        __m256 a = _mm256_mul_ps(_mm256_sub_ps(t, _mm256_cvtepi32_ps(q)), _mm256_set1_ps(GEO_HALF_PI));
+        __m256 a2 = _mm256_mul_ps(a, a);
+        
+        __m256 sp = _mm256_add_ps(_mm256_set1_ps(SIN_9), _mm256_mul_ps(a2, _mm256_set1_ps(SIN_11)));
+        sp = _mm256_add_ps(_mm256_set1_ps(SIN_7), _mm256_mul_ps(a2, sp));
+        sp = _mm256_add_ps(_mm256_set1_ps(SIN_5), _mm256_mul_ps(a2, sp));
+        sp = _mm256_add_ps(_mm256_set1_ps(SIN_3), _mm256_mul_ps(a2, sp));
+        sp = _mm256_add_ps(a, _mm256_mul_ps(a, _mm256_mul_ps(a2, sp)));
+        
+        __m256 cp = _mm256_add_ps(_mm256_set1_ps(COS_10), _mm256_mul_ps(a2, _mm256_set1_ps(COS_12)));
+        cp = _mm256_add_ps(_mm256_set1_ps(COS_8), _mm256_mul_ps(a2, cp));
+        cp = _mm256_add_ps(_mm256_set1_ps(COS_6), _mm256_mul_ps(a2, cp));
+        cp = _mm256_add_ps(_mm256_set1_ps(COS_4), _mm256_mul_ps(a2, cp));
+        cp = _mm256_add_ps(_mm256_set1_ps(COS_2), _mm256_mul_ps(a2, cp));
+        cp = _mm256_add_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(a2, cp));
+        
+        // Odd quadrants swap sin and cos; the sign masks follow the quadrant table
+        __m256i one = _mm256_set1_epi32(1);
+        __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(q, one), one));
+        __m256 sign = _mm256_set1_ps(-0.0f);
+        __m256 s_neg = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_srli_epi32(q, 1), 31));
+        __m256 c_neg = _mm256_castsi256_ps(_mm256_slli_epi32(
+            _mm256_xor_si256(q, _mm256_srli_epi32(q, 1)), 31));
+        
+        s = _mm256_xor_ps(_mm256_blendv_ps(sp, cp, swap), _mm256_and_ps(s_neg, sign));
+        c = _mm256_xor_ps(_mm256_blendv_ps(cp, sp, swap), _mm256_and_ps(c_neg, sign));
+    }
+    
+    RANDOMIX_TARGET("avx2")
+    inline __m256 geo_cbrt_avx2(__m256 u) {
+        // Unsigned divide by 3 of the float bits: (bits * 0xAAAAAAAB) >> 33
+        __m256i bits = _mm256_castps_si256(u);
+        __m256i magic = _mm256_set1_epi64x(0xAAAAAAABLL);
+        __m256i even = _mm256_srli_epi64(_mm256_mul_epu32(bits, magic), 33);
+        __m256i odd = _mm256_srli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(bits, 32), magic), 33);
+        __m256i third = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+        __m256 y = _mm256_castsi256_ps(_mm256_add_epi32(third, _mm256_set1_epi32(static_cast<int>(CBRT_MAGIC))));
+        
+        __m256 three = _mm256_set1_ps(3.0f);
+        for (int i = 0; i < 3; ++i) {
+            __m256 y2 = _mm256_mul_ps(y, y);
+            __m256 num = _mm256_sub_ps(_mm256_mul_ps(y2, y), u);
+            __m256 den = _mm256_mul_ps(_mm256_mul_ps(three, y), y);
+            y = _mm256_sub_ps(y, _mm256_div_ps(num, den));
+        }
+        return y;
+    }
+    
+    RANDOMIX_TARGET("avx2")
+    size_t geo_disc_avx2(const uint32_t* radial, const uint32_t* angular, size_t count, float cx, float cy,
+        float sx, float sy, float r0, float dr, float* x, float* y) {
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            __m256 r = _mm256_set1_ps(1.0f);
+            if (radial) {
+                r = _mm256_sqrt_ps(_mm256_add_ps(_mm256_set1_ps(r0),
+                    _mm256_mul_ps(geo_unit_avx2(radial + i), _mm256_set1_ps(dr))));
+            }
+            
+            __m256 s, c;
+            geo_sincos_avx2(geo_unit_avx2(angular + i), s, c);
+            
+            _mm256_storeu_ps(x + i, _mm256_add_ps(_mm256_set1_ps(cx), _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(sx), r), c)));
+            _mm256_storeu_ps(y + i, _mm256_add_ps(_mm256_set1_ps(cy), _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(sy), r), s)));
+        }
+        return i;
+    }
+    
+    RANDOMIX_TARGET("avx2")
+    size_t geo_sphere_avx2(const uint32_t* radial, const uint32_t* polar, const uint32_t* angular, size_t count,
+        float cx, float cy, float cz, float radius, float* x, float* y, float* z) {
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            __m256 r = _mm256_set1_ps(radius);
+            if (radial) {
+                r = _mm256_mul_ps(r, geo_cbrt_avx2(geo_unit_avx2(radial + i)));
+            }
+            
+            // Uniform height on [-1, 1] gives a uniform direction (Archimedes)
+            __m256 h = _mm256_sub_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(_mm256_set1_ps(2.0f), geo_unit_avx2(polar + i)));
+            __m256 rho = _mm256_sqrt_ps(_mm256_max_ps(_mm256_setzero_ps(),
+                _mm256_sub_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(h, h))));
+            
+            __m256 s, c;
+            geo_sincos_avx2(geo_unit_avx2(angular + i), s, c);
+            
+            __m256 rr = _mm256_mul_ps(r, rho);
+            _mm256_storeu_ps(x + i, _mm256_add_ps(_mm256_set1_ps(cx), _mm256_mul_ps(rr, c)));
+            _mm256_storeu_ps(y + i, _mm256_add_ps(_mm256_set1_ps(cy), _mm256_mul_ps(rr, s)));
+            _mm256_storeu_ps(z + i, _mm256_add_ps(_mm256_set1_ps(cz), _mm256_mul_ps(r, h)));
+        }
+        return i;
+    }
+#endif
+    
+    void geo_disc(const uint32_t* radial, const uint32_t* angular, size_t count, float cx, float cy,
+        float sx, float sy, float r0, float dr, float* x, float* y) {
+        size_t i = 0;
+#if RANDOMIX_X86
+        if (simd_level() >= SIMD_AVX2) {
+            i = geo_disc_avx2(radial, angular, count, cx, cy, sx, sy, r0, dr, x, y);
+        }
+#endif
+        for (; i < count; ++i) {
+            float r = radial ? std::sqrt(r0 + geo_unit(radial[i]) * dr) : 1.0f;
+            float s, c;
+            geo_sincos(geo_unit(angular[i]), s, c);
+            x[i] = cx + (sx * r) * c;
+            y[i] = cy + (sy * r) * s;
+        }
+    }
+    
+    void geo_sphere(const uint32_t* radial, const uint32_t* polar, const uint32_t* angular, size_t count,
+        float cx, float cy, float cz, float radius, float* x, float* y, float* z) {
+        size_t i = 0;
+#if RANDOMIX_X86
+        if (simd_level() >= SIMD_AVX2) {
+            i = geo_sphere_avx2(radial, polar, angular, count, cx, cy, cz, radius, x, y, z);
+        }
+#endif
+        for (; i < count; ++i) {
+            float r = radial ? radius * geo_cbrt(geo_unit(radial[i])) : radius;
+            float h = 1.0f - 2.0f * geo_unit(polar[i]);
+            float rho = std::sqrt(std::max(0.0f, 1.0f - h * h));
+            float s, c;
+            geo_sincos(geo_unit(angular[i]), s, c);
+            
+            float rr = r * rho;
+            x[i] = cx + rr * c;
+            y[i] = cy + rr * s;
+            z[i] = cz + r * h;
+        }
+    }
+}
+
+namespace RandomixGeometry {
+    void disc(const uint32_t* words, size_t count, float cx, float cy, float sx, float sy,
+        float r0, float dr, float* x, float* y) {
+        geo_disc(words, words + count, count, cx, cy, sx, sy, r0, dr, x, y);
+    }
+    
+    void circle_edge(const uint32_t* words, size_t count, float cx, float cy, float radius, float* x, float* y) {
+        geo_disc(nullptr, words, count, cx, cy, radius, radius, 1.0f, 0.0f, x, y);
+    }
+    
+    void rect(const uint32_t* words, size_t count, float minX, float minY, float maxX, float maxY, float* x, float* y) {
+        const uint32_t* ux = words;
+        const uint32_t* uy = words + count;
+        for (size_t i = 0; i < count; ++i) {
+            x[i] = minX + geo_unit(ux[i]) * (maxX - minX);
+            y[i] = minY + geo_unit(uy[i]) * (maxY - minY);
+        }
+    }
+    
+    void sphere(const uint32_t* words, size_t count, float cx, float cy, float cz, float radius,
+        float* x, float* y, float* z) {
+        geo_sphere(words, words + count, words + 2 * count, count, cx, cy, cz, radius, x, y, z);
+    }
+    
+    void sphere_surface(const uint32_t* words, size_t count, float cx, float cy, float cz, float radius,
+        float* x, float* y, float* z) {
+        geo_sphere(nullptr, words, words + count, count, cx, cy, cz, radius, x, y, z);
+    }
+    
+    void box(const uint32_t* words, size_t count, float minX, float minY, float minZ,
+        float maxX, float maxY, float maxZ, float* x, float* y, float* z) {
+        const uint32_t* ux = words;
+        const uint32_t* uy = words + count;
+        const uint32_t* uz = words + 2 * count;
+        for (size_t i = 0; i < count; ++i) {
+            x[i] = minX + geo_unit(ux[i]) * (maxX - minX);
+            y[i] = minY + geo_unit(uy[i]) * (maxY - minY);
+            z[i] = minZ + geo_unit(uz[i]) * (maxZ - minZ);
+        }
+    }
+}
+
+// RandomixNormal Tables
+// Layer edges from Marsaglia & Tsang's zigset: 128 layers of equal area
+// vn, the base layer plus the tail past TAIL.
+namespace {
+    RandomixNormal::Tables build_ziggurat() {
+        RandomixNormal::Tables t{};
+        const double m1 = 2147483648.0;
+        const double vn = 9.91256303526217e-3;
+        double dn = 3.442619855899;
+        double tn = dn;
+        double q = vn / std::exp(-0.5 * dn * dn);
+        
+        t.kn[0] = static_cast<uint32_t>((dn / q) * m1);
+        t.kn[1] = 0;
+        t.wn[0] = static_cast<float>(q / m1);
+        t.wn[RandomixNormal::LAYERS - 1] = static_cast<float>(dn / m1);
+        t.fn[0] = 1.0f;
+        t.fn[RandomixNormal::LAYERS - 1] = static_cast<float>(std::exp(-0.5 * dn * dn));
+        
+        for (int i = RandomixNormal::LAYERS - 2; i >= 1; --i) {
+            dn = std::sqrt(-2.0 * std::log(vn / dn + std::exp(-0.5 * dn * dn)));
+            t.kn[i + 1] = static_cast<uint32_t>((dn / tn) * m1);
+            tn = dn;
+            t.fn[i] = static_cast<float>(std::exp(-0.5 * dn * dn));
+            t.wn[i] = static_cast<float>(dn / m1);
+        }
+        return t;
+    }
+}
+
+const RandomixNormal::Tables RandomixNormal::ZIGGURAT = build_ziggurat();
+
+// AliasTable Implementation
+namespace {
+    // Vose's method over weights normalised to mean 1
+    template <typename W>
+    bool build_alias(const W* weights, size_t count, std::vector<uint32_t>& prob, std::vector<uint32_t>& alias) {
+        if (count == 0 || count > UINT32_MAX) return false;
+        
+        double total = 0.0;
+        size_t heaviest = 0;
+        for (size_t i = 0; i < count; ++i) {
+            if (weights[i] > 0) total += static_cast<double>(weights[i]);
+            if (weights[i] > weights[heaviest]) heaviest = i;
+        }
+        if (!(total > 0.0) || !std::isfinite(total)) return false;
+        
+        std::vector<double> scaled(count);
+        std::vector<uint32_t> small, large;
+        small.reserve(count);
+        large.reserve(count);
+        
+        double scale = static_cast<double>(count) / total;
+        for (size_t i = 0; i < count; ++i) {
+            scaled[i] = weights[i] > 0 ? static_cast<double>(weights[i]) * scale : 0.0;
+            (scaled[i] < 1.0 ? small : large).push_back(static_cast<uint32_t>(i));
+        }
+        
+        prob.assign(count, UINT32_MAX);
+        alias.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            alias[i] = static_cast<uint32_t>(i);
+        }
+        
+        while (!small.empty() && !large.empty()) {
+            uint32_t s = small.back();
+            small.pop_back();
+            uint32_t l = large.back();
+            
+            prob[s] = static_cast<uint32_t>(scaled[s] * 4294967296.0);
+            alias[s] = l;
+            
+            scaled[l] -= 1.0 - scaled[s];
+            if (scaled[l] < 1.0) {
+                large.pop_back();
+                small.push_back(l);
+            }
+        }
+        
+        // Leftovers are 1 up to rounding and keep the UINT32_MAX/self default,
+        // except zero-weight columns which must never keep their own index
+        for (uint32_t s : small) {
+            if (scaled[s] <= 0.0) {
+                prob[s] = 0;
+                alias[s] = static_cast<uint32_t>(heaviest);
+            }
+        }
+        return true;
+    }
+}
+
+bool AliasTable::build(const int32_t* weights, size_t count) {
+    return build_alias(weights, count, prob, alias);
+}
+
+bool AliasTable::build(const double* weights, size_t count) {
+    return build_alias(weights, count, prob, alias);
+}
+
+// WeightedSet Implementation
+WeightedSet::WeightedSet(size_t count)
+    : weights(count, 0), tree(count + 1, 0) {
+    top_step = 1;
+    while (top_step * 2 <= count) top_step *= 2;
+}
+
+void WeightedSet::assign(const int32_t* values, size_t count) {
+    count = std::min(count, weights.size());
+    std::fill(weights.begin(), weights.end(), 0u);
+    std::fill(tree.begin(), tree.end(), 0u);
+    
+    for (size_t i = 0; i < count; ++i) {
+        weights[i] = values[i] > 0 ? static_cast<uint32_t>(values[i]) : 0u;
+        tree[i + 1] += weights[i];
+    }
+    
+    // Push each partial sum into its parent once: O(n) build
+    total_weight = 0;
+    for (size_t i = 1; i < tree.size(); ++i) {
+        size_t parent = i + (i & (0 - i));
+        if (parent < tree.size()) tree[parent] += tree[i];
+        total_weight += weights[i - 1];
+    }
+}
+
+void WeightedSet::update(size_t index, int64_t delta) {
+    for (size_t i = index + 1; i < tree.size(); i += i & (0 - i)) {
+        tree[i] += static_cast<uint64_t>(delta);
+    }
+    total_weight += static_cast<uint64_t>(delta);
+}
+
+void WeightedSet::set_weight(size_t index, uint32_t weight) {
+    int64_t delta = static_cast<int64_t>(weight) - static_cast<int64_t>(weights[index]);
+    if (delta == 0) return;
+    
+    weights[index] = weight;
+    update(index, delta);
+}
+
+size_t WeightedSet::find(uint64_t target) const {
+    size_t pos = 0;
+    for (size_t step = top_step; step > 0; step >>= 1) {
+        size_t next = pos + step;
+        if (next < tree.size() && tree[next] <= target) {
+            pos = next;
+            target -= tree[next];
+        }
+    }
+    return pos;
+}
+
+// Deck Implementation
+Deck::Deck(uint32_t deck_size, uint32_t decks, Source source)
+    : cards(static_cast<size_t>(deck_size) * decks), deck_size(deck_size), source(source) {
+    for (size_t i = 0; i < cards.size(); ++i) {
+        cards[i] = static_cast<uint32_t>(i);
+    }
+}
+
+// FeistelPermutation Implementation
+uint32_t FeistelPermutation::round(uint32_t half, uint64_t key) const {
+    uint64_t x = (static_cast<uint64_t>(half) + key) * 0x9E3779B97F4A7C15ULL;
+    x ^= x >> 32;
+    x *= 0xD6E8FEB86659FD93ULL;
+    x ^= x >> 32;
+    return static_cast<uint32_t>(x) & half_mask;
+}
+
+uint32_t FeistelPermutation::encrypt(uint32_t x) const {
+    uint32_t left = x >> half_bits;
+    uint32_t right = x & half_mask;
+    
+    for (int i = 0; i < ROUNDS; ++i) {
+        uint32_t next = left ^ round(right, keys[i]);
+        left = right;
+        right = next;
+    }
+    return (left << half_bits) | right;
+}
+
+uint32_t FeistelPermutation::decrypt(uint32_t x) const {
+    uint32_t left = x >> half_bits;
+    uint32_t right = x & half_mask;
+    
+    for (int i = ROUNDS - 1; i >= 0; --i) {
+        uint32_t prev = right ^ round(left, keys[i]);
+        right = left;
+        left = prev;
+    }
+    return (left << half_bits) | right;
+}
+
+// Cycle walking: the network permutes [0, 2^(2 * half_bits)), so stepping
+// along the cycle until the value lands below n permutes [0, n)
+uint32_t FeistelPermutation::forward(uint32_t index) const {
+    uint32_t x = encrypt(index);
+    while (x >= n) x = encrypt(x);
+    return x;
+}
+
+uint32_t FeistelPermutation::inverse(uint32_t value) const {
+    uint32_t x = decrypt(value);
+    while (x >= n) x = decrypt(x);
+    return x;
+}
+
+// DiceExpression Implementation
+namespace {
+    void skip_spaces(const char*& p) {
+        while (*p == ' ' || *p == '\t') ++p;
+    }
+    
+    // Decimal number up to limit; false if there are no digits or it overflows
+    bool parse_number(const char*& p, uint32_t limit, uint32_t& value) {
+        skip_spaces(p);
+        if (*p < '0' || *p > '9') return false;
+        
+        uint64_t v = 0;
+        while (*p >= '0' && *p <= '9') {
+            v = v * 10 + static_cast<uint64_t>(*p - '0');
+            if (v > limit) return false;
+            ++p;
+        }
+        value = static_cast<uint32_t>(v);
+        return true;
+    }
+    
+    char lower(char c) {
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+    
+    // Keep/drop modifiers and '!' after NdS
+    bool parse_modifiers(const char*& p, DiceExpression::Term& t) {
+        for (;;) {
+            skip_spaces(p);
+            char c = lower(*p);
+            
+            if (c == '!') {
+                if (t.explode || t.sides < 2) return false;
+                t.explode = true;
+                ++p;
+                continue;
+            }
+            
+            if (c != 'k' && c != 'd') return true;
+            if (t.keep != t.count) return false;
+            
+            bool keep = c == 'k';
+            bool high = keep;
+            ++p;
+            
+            char which = lower(*p);
+            if (which == 'h' || which == 'l') {
+                high = which == 'h';
+                ++p;
+            }
+            
+            uint32_t n = 1;
+            skip_spaces(p);
+            if (*p >= '0' && *p <= '9' && !parse_number(p, DiceExpression::MAX_DICE, n)) return false;
+            n = std::min(n, t.count);
+            
+            // Dropping the lowest n is keeping the highest count - n
+            t.keep = keep ? n : t.count - n;
+            t.keep_high = keep ? high : !high;
+        }
+    }
+}
+
+bool DiceExpression::parse(const char* text) {
+    std::vector<Term> parsed;
+    const char* p = text;
+    int32_t sign = 1;
+    
+    skip_spaces(p);
+    if (*p == '+' || *p == '-') {
+        sign = *p == '-' ? -1 : 1;
+        ++p;
+    }
+    
+    for (;;) {
+        if (parsed.size() == MAX_TERMS) return false;
+        
+        Term t;
+        t.sign = sign;
+        
+        uint32_t number = 0;
+        bool has_number = parse_number(p, 1000000000, number);
+        skip_spaces(p);
+        
+        if (lower(*p) == 'd') {
+            ++p;
+            t.count = has_number ? number : 1;
+            if (t.count == 0 || t.count > MAX_DICE) return false;
+            
+            skip_spaces(p);
+            if (*p == '%') {
+                t.sides = 100;
+                ++p;
+            } else if (!parse_number(p, MAX_SIDES, t.sides) || t.sides == 0) {
+                return false;
+            }
+            
+            t.keep = t.count;
+            if (!parse_modifiers(p, t)) return false;
+            RandomixDice::packing(t.sides, t.digits, t.bound);
+        } else if (has_number) {
+            t.constant = static_cast<int32_t>(number);
+        } else {
+            return false;
+        }
+        parsed.push_back(t);
+        
+        skip_spaces(p);
+        if (*p == '\0') break;
+        if (*p != '+' && *p != '-') return false;
+        sign = *p == '-' ? -1 : 1;
+        ++p;
+    }
+    
+    terms.swap(parsed);
+    return true;
+}
+
+// Polygon Implementation
+namespace {
+    struct Point2 {
+        double x, y;
+    };
+    
+    double cross(const Point2& a, const Point2& b, const Point2& c) {
+        return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+    }
+    
+    bool same_point(const Point2& a, const Point2& b) {
+        return a.x == b.x && a.y == b.y;
+    }
+    
+    // Twice the signed area, positive when counter-clockwise
+    double ring_area(const std::vector<Point2>& ring) {
+        double sum = 0.0;
+        for (size_t i = 0, j = ring.size() - 1; i < ring.size(); j = i++) {
+            sum += (ring[j].x - ring[i].x) * (ring[j].y + ring[i].y);
+        }
+        return sum;
+    }
+    
+    // Ring without repeated neighbours, wound counter-clockwise (outline) or
+    // clockwise (hole); empty if it is not finite or has no area
+    std::vector<Point2> load_ring(const std::vector<float>& xy, bool ccw) {
+        std::vector<Point2> ring;
+        ring.reserve(xy.size() / 2);
+        
+        for (size_t i = 0; i + 1 < xy.size(); i += 2) {
+            Point2 p = { xy[i], xy[i + 1] };
+            if (!std::isfinite(p.x) || !std::isfinite(p.y)) return {};
+            if (ring.empty() || !same_point(ring.back(), p)) ring.push_back(p);
+        }
+        while (ring.size() > 1 && same_point(ring.front(), ring.back())) ring.pop_back();
+        
+        if (ring.size() < 3) return {};
+        double area = ring_area(ring);
+        if (area == 0.0) return {};
+        if ((area > 0.0) != ccw) std::reverse(ring.begin(), ring.end());
+        return ring;
+    }
+    
+    // Whether a segment from v towards p leaves into the interior of a
+    // counter-clockwise ring, given v's neighbours
+    bool locally_inside(const Point2& prev, const Point2& v, const Point2& next, const Point2& p) {
+        if (cross(prev, v, next) >= 0.0) {
+            return cross(prev, v, p) >= 0.0 && cross(v, next, p) >= 0.0;
+        }
+        return cross(prev, v, p) >= 0.0 || cross(v, next, p) >= 0.0;
+    }
+    
+    // Splices a clockwise hole into the counter-clockwise outline through a
+    // bridge from the hole's rightmost vertex to a visible outline vertex
+    // (Eberly's method); false if the hole is not inside the outline
+    bool bridge_hole(std::vector<Point2>& outline, const std::vector<Point2>& hole) {
+        size_t m = 0;
+        for (size_t i = 1; i < hole.size(); ++i) {
+            if (hole[i].x > hole[m].x) m = i;
+        }
+        const Point2 M = hole[m];
+        size_t n = outline.size();
+        
+        // Nearest edge the ray from M towards +x leaves the interior through:
+        // an upward edge, counting its end vertices so the ray can't slip
+        // past a vertex it grazes
+        double hit_x = std::numeric_limits<double>::infinity();
+        size_t edge = n;
+        for (size_t i = 0; i < n; ++i) {
+            const Point2& a = outline[i];
+            const Point2& b = outline[(i + 1) % n];
+            if (!(a.y <= M.y && M.y <= b.y && a.y < b.y)) continue;
+            
+            double x = a.x + (M.y - a.y) * (b.x - a.x) / (b.y - a.y);
+            if (x >= M.x && x < hit_x) {
+                hit_x = x;
+                edge = i;
+            }
+        }
+        if (edge == n) return false;
+        
+        // Candidate: the crossed edge's endpoint furthest along the ray,
+        // unless a reflex vertex in or on (M, hit, candidate) blocks the
+        // view; then the blocking vertex with the smallest angle to the ray
+        const Point2 I = { hit_x, M.y };
+        Point2 P = outline[edge].x > outline[(edge + 1) % n].x ? outline[edge] : outline[(edge + 1) % n];
+        if (same_point(outline[edge], I)) P = outline[edge];
+        if (same_point(outline[(edge + 1) % n], I)) P = outline[(edge + 1) % n];
+        
+        const Point2 candidate = P;
+        double max_x = std::max(I.x, candidate.x);
+        double min_y = std::min(M.y, candidate.y);
+        double max_y = std::max(M.y, candidate.y);
+        double best_tan = std::numeric_limits<double>::infinity();
+        double best_dx = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            const Point2& v = outline[i];
+            if (same_point(v, candidate) || v.x <= M.x || v.x > max_x || v.y < min_y || v.y > max_y) continue;
+            if (cross(outline[(i + n - 1) % n], v, outline[(i + 1) % n]) >= 0.0) continue;
+            
+            double d1 = cross(M, I, v);
+            double d2 = cross(I, candidate, v);
+            double d3 = cross(candidate, M, v);
+            bool inside = (d1 >= 0.0 && d2 >= 0.0 && d3 >= 0.0) || (d1 <= 0.0 && d2 <= 0.0 && d3 <= 0.0);
+            if (!inside) continue;
+            
+            double dx = v.x - M.x;
+            double tan = std::fabs(v.y - M.y) / dx;
+            if (tan < best_tan || (tan == best_tan && dx < best_dx)) {
+                best_tan = tan;
+                best_dx = dx;
+                P = v;
+            }
+        }
+        
+        // Earlier bridges duplicate vertices; take the copy the bridge leaves
+        // into the interior from
+        size_t p = n;
+        for (size_t i = 0; i < n; ++i) {
+            if (!same_point(outline[i], P)) continue;
+            if (p == n) p = i;
+            if (locally_inside(outline[(i + n - 1) % n], outline[i], outline[(i + 1) % n], M)) {
+                p = i;
+                break;
+            }
+        }
+        
+        std::vector<Point2> merged;
+        merged.reserve(n + hole.size() + 2);
+        merged.insert(merged.end(), outline.begin(), outline.begin() + p + 1);
+        for (size_t i = 0; i <= hole.size(); ++i) {
+            merged.push_back(hole[(m + i) % hole.size()]);
+        }
+        merged.insert(merged.end(), outline.begin() + p, outline.end());
+        outline.swap(merged);
+        return true;
+    }
+    
+    // Ear clipping over one counter-clockwise ring; bridge vertices appear
+    // twice, so vertices sharing an ear corner's position never block it
+    bool ear_clip(const std::vector<Point2>& pts, std::vector<std::array<size_t, 3>>& out) {
+        size_t n = pts.size();
+        std::vector<size_t> prev(n), next(n);
+        for (size_t i = 0; i < n; ++i) {
+            prev[i] = (i + n - 1) % n;
+            next[i] = (i + 1) % n;
+        }
+        
+        auto is_ear = [&](size_t a, size_t v, size_t c) {
+            for (size_t w = next[c]; w != a; w = next[w]) {
+                const Point2& p = pts[w];
+                if (same_point(p, pts[a]) || same_point(p, pts[v]) || same_point(p, pts[c])) continue;
+                if (cross(pts[prev[w]], p, pts[next[w]]) > 0.0) continue;
+                if (cross(pts[a], pts[v], p) >= 0.0 && cross(pts[v], pts[c], p) >= 0.0 && cross(pts[c], pts[a], p) >= 0.0) {
+                    return false;
+                }
+            }
+            return true;
+        };
+        
+        size_t remaining = n;
+        size_t v = 0;
+        size_t stalled = 0;
+        while (remaining > 3) {
+            size_t a = prev[v];
+            size_t c = next[v];
+            double turn = cross(pts[a], pts[v], pts[c]);
+            
+            // Collinear corners and spikes hold no area and are dropped
+            if (turn == 0.0 || (turn > 0.0 && is_ear(a, v, c))) {
+                if (turn > 0.0) out.push_back({ a, v, c });
+                next[a] = c;
+                prev[c] = a;
+                --remaining;
+                stalled = 0;
+            } else if (++stalled > remaining) {
+                return false;
+            }
+            v = c;
+        }
+        
+        size_t a = prev[v];
+        size_t c = next[v];
+        if (cross(pts[a], pts[v], pts[c]) > 0.0) out.push_back({ a, v, c });
+        return true;
+    }
 }
 
-void PCG32::seed(uint64_t seed) {
-    state = 0;
-    inc = (INCREMENT << 1u) | 1u;
-    next_uint32();
-    state += seed;
-    next_uint32();
+bool Polygon::triangulate() {
+    std::vector<Point2> outline = load_ring(rings[0], true);
+    if (outline.empty()) return false;
+    double expected = ring_area(outline);
+    
+    std::vector<std::pair<double, std::vector<Point2>>> holes;
+    for (size_t i = 1; i < rings.size(); ++i) {
+        std::vector<Point2> hole = load_ring(rings[i], false);
+        if (hole.empty()) return false;
+        expected += ring_area(hole);
+        
+        double right = hole[0].x;
+        for (const Point2& p : hole) right = std::max(right, p.x);
+        holes.emplace_back(right, std::move(hole));
+    }
+    if (expected <= 0.0) return false;
+    
+    // Rightmost holes first so every ray only meets holes already spliced in
+    std::sort(holes.begin(), holes.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+    for (const auto& hole : holes) {
+        if (!bridge_hole(outline, hole.second)) return false;
+    }
+    
+    std::vector<std::array<size_t, 3>> corners;
+    if (!ear_clip(outline, corners)) return false;
+    
+    std::vector<Triangle> clipped;
+    std::vector<double> areas;
+    double sum = 0.0;
+    for (const auto& t : corners) {
+        const Point2& a = outline[t[0]];
+        const Point2& b = outline[t[1]];
+        const Point2& c = outline[t[2]];
+        double twice = cross(a, b, c);
+        
+        clipped.push_back({ static_cast<float>(a.x), static_cast<float>(a.y),
+            static_cast<float>(b.x - a.x), static_cast<float>(b.y - a.y),
+            static_cast<float>(c.x - a.x), static_cast<float>(c.y - a.y) });
+        areas.push_back(twice);
+        sum += twice;
+    }
+    
+    // Crossing rings still clip, but the pieces no longer add up to the area
+    if (clipped.empty() || std::fabs(sum - expected) > expected * 1e-6) return false;
+    
+    AliasTable table;
+    if (!table.build(areas.data(), areas.size())) return false;
+    
+    triangles.swap(clipped);
+    picker = std::move(table);
+    total_area = sum * 0.5;
+    
+    min_x = max_x = static_cast<float>(outline[0].x);
+    min_y = max_y = static_cast<float>(outline[0].y);
+    for (const Point2& p : outline) {
+        min_x = std::min(min_x, static_cast<float>(p.x));
+        min_y = std::min(min_y, static_cast<float>(p.y));
+        max_x = std::max(max_x, static_cast<float>(p.x));
+        max_y = std::max(max_y, static_cast<float>(p.y));
+    }
+    return true;
 }
 
-uint32_t PCG32::next_uint32() {
-    uint64_t oldstate = state;
-    state = oldstate * MULTIPLIER + inc;
+bool Polygon::contains(float x, float y) const {
+    bool inside = false;
+    for (const std::vector<float>& ring : rings) {
+        size_t n = ring.size() / 2;
+        for (size_t i = 0, j = n - 1; i < n; j = i++) {
+            float xi = ring[i * 2], yi = ring[i * 2 + 1];
+            float xj = ring[j * 2], yj = ring[j * 2 + 1];
+            if ((yi > y) != (yj > y) && x < (xj - xi) * (y - yi) / (yj - yi) + xi) inside = !inside;
+        }
+    }
+    return inside;
+}
+
+bool Polygon::set_outline(const float* xy, size_t count) {
+    if (count < 3 || count > MAX_VERTICES) return false;
     
-    uint32_t xorshifted = static_cast<uint32_t>(((oldstate >> 18u) ^ oldstate) >> 27u);
-    uint32_t rot = static_cast<uint32_t>(oldstate >> 59u);
+    std::vector<std::vector<float>> previous;
+    previous.swap(rings);
+    rings.emplace_back(xy, xy + count * 2);
     
-    return (xorshifted >> rot) | (xorshifted << ((~rot + 1) & 31u));
+    if (triangulate()) {
+        vertex_count = count;
+        return true;
+    }
+    rings.swap(previous);
+    return false;
 }
 
-float PCG32::next_float() {
-    return static_cast<float>(next_uint32()) / 4294967296.0f;
+bool Polygon::add_hole(const float* xy, size_t count) {
+    if (rings.empty() || count < 3 || vertex_count + count > MAX_VERTICES) return false;
+    
+    rings.emplace_back(xy, xy + count * 2);
+    if (triangulate()) {
+        vertex_count += count;
+        return true;
+    }
+    rings.pop_back();
+    return false;
 }
 
-uint32_t PCG32::next_bounded(uint32_t bound) {
-    if (bound == 0) return 0;
+// Polyline Implementation
+bool Polyline::append(const float* points, size_t count, bool closed) {
+    if (count < 2 || point_count + count > MAX_POINTS) return false;
     
-    uint64_t m = static_cast<uint64_t>(next_uint32()) * static_cast<uint64_t>(bound);
-    uint32_t leftover = static_cast<uint32_t>(m);
+    std::vector<Segment> added;
+    std::vector<double> lengths;
+    size_t edges = closed ? count : count - 1;
     
-    if (leftover < bound) {
-        uint32_t threshold = (0u - bound) % bound;
-        while (leftover < threshold) {
-            m = static_cast<uint64_t>(next_uint32()) * static_cast<uint64_t>(bound);
-            leftover = static_cast<uint32_t>(m);
+    for (size_t i = 0; i < edges; ++i) {
+        const float* a = points + i * dims;
+        const float* b = points + ((i + 1) % count) * dims;
+        float az = dims == 3 ? a[2] : 0.0f;
+        float bz = dims == 3 ? b[2] : 0.0f;
+        
+        Segment s = { a[0], a[1], az, b[0] - a[0], b[1] - a[1], bz - az, 0.0f, 0.0f };
+        double length = std::sqrt(static_cast<double>(s.dx) * s.dx + static_cast<double>(s.dy) * s.dy +
+            static_cast<double>(s.dz) * s.dz);
+        if (!std::isfinite(length)) return false;
+        if (length == 0.0) continue;
+        
+        // Vertical segments have no horizontal normal and get no jitter
+        double flat = std::sqrt(static_cast<double>(s.dx) * s.dx + static_cast<double>(s.dy) * s.dy);
+        if (flat > 0.0) {
+            s.nx = static_cast<float>(-s.dy / flat);
+            s.ny = static_cast<float>(s.dx / flat);
         }
+        added.push_back(s);
+        lengths.push_back(length);
     }
+    if (added.empty()) return false;
     
-    return static_cast<uint32_t>(m >> 32);
+    // The alias table covers every segment, old and new
+    std::vector<double> all;
+    all.reserve(segments.size() + added.size());
+    double previous = 0.0;
+    for (double total : cumulative) {
+        all.push_back(total - previous);
+        previous = total;
+    }
+    all.insert(all.end(), lengths.begin(), lengths.end());
+    
+    AliasTable table;
+    if (!table.build(all.data(), all.size())) return false;
+    
+    for (size_t i = 0; i < added.size(); ++i) {
+        segments.push_back(added[i]);
+        cumulative.push_back(length() + lengths[i]);
+    }
+    picker = std::move(table);
+    point_count += count;
+    return true;
+}
+
+void Polyline::at(double distance, float& x, float& y, float& z) const {
+    distance = std::min(std::max(distance, 0.0), length());
+    
+    size_t i = std::lower_bound(cumulative.begin(), cumulative.end(), distance) - cumulative.begin();
+    if (i >= segments.size()) i = segments.size() - 1;
+    
+    double start = i == 0 ? 0.0 : cumulative[i - 1];
+    double span = cumulative[i] - start;
+    float t = static_cast<float>(span > 0.0 ? (distance - start) / span : 0.0);
+    
+    const Segment& s = segments[i];
+    x = s.x + t * s.dx;
+    y = s.y + t * s.dy;
+    z = s.z + t * s.dz;
+}
+
+// ZoneSet Implementation
+RandomixZones::Capsule::Capsule(float x1, float y1, float z1, float x2, float y2, float z2, float radius)
+    : x(x1), y(y1), z(z1), ax(x2 - x1), ay(y2 - y1), az(z2 - z1), radius(radius) {
+    length = std::sqrt(ax * ax + ay * ay + az * az);
+    
+    // Any unit pair across the axis will do; start from the world axis least
+    // aligned with it so the cross product is well conditioned
+    float wx = 0.0f, wy = 0.0f, wz = 1.0f;
+    if (length > 0.0f) {
+        wx = ax / length;
+        wy = ay / length;
+        wz = az / length;
+    }
+    float hx = std::fabs(wx) < 0.9f ? 1.0f : 0.0f;
+    float hy = 1.0f - hx;
+    
+    ux = -wz * hy;
+    uy = wz * hx;
+    uz = wx * hy - wy * hx;
+    float norm = std::sqrt(ux * ux + uy * uy + uz * uz);
+    ux /= norm; uy /= norm; uz /= norm;
+    
+    vx = wy * uz - wz * uy;
+    vy = wz * ux - wx * uz;
+    vz = wx * uy - wy * ux;
+}
+
+bool ZoneSet::add(const RandomixZones::Zone& zone) {
+    if (zones.size() >= MAX_ZONES) return false;
+    
+    double volume = std::visit([](const auto& z) { return z.volume(); }, zone);
+    if (!(volume > 0.0) || !std::isfinite(volume)) return false;
+    
+    std::vector<double> volumes;
+    volumes.reserve(zones.size() + 1);
+    for (const auto& z : zones) {
+        volumes.push_back(std::visit([](const auto& v) { return v.volume(); }, z));
+    }
+    volumes.push_back(volume);
+    
+    AliasTable table;
+    if (!table.build(volumes.data(), volumes.size())) return false;
+    picker = std::move(table);
+    
+    RandomixZones::Bounds sphere = std::visit([](const auto& z) { return z.bounds(); }, zone);
+    uint32_t index = static_cast<uint32_t>(zones.size());
+    overlaps.emplace_back();
+    for (uint32_t i = 0; i < index; ++i) {
+        float dx = bounds[i].x - sphere.x, dy = bounds[i].y - sphere.y, dz = bounds[i].z - sphere.z;
+        float reach = bounds[i].radius + sphere.radius;
+        if (dx * dx + dy * dy + dz * dz <= reach * reach) {
+            overlaps[i].push_back(index);
+            overlaps[index].push_back(i);
+        }
+    }
+    
+    zones.push_back(zone);
+    bounds.push_back(sphere);
+    return true;
+}
+
+bool ZoneSet::contains(float x, float y, float z) const {
+    for (const auto& zone : zones) {
+        if (std::visit([&](const auto& v) { return v.contains(x, y, z); }, zone)) return true;
+    }
+    return false;
+}
+
+// ChaCha Block Kernels
+// Every kernel writes `blocks` consecutive 64-byte blocks starting at the
+// counter in input[12..13]. The SIMD kernels run 4, 8 or 16 blocks side by
+// side (one block per lane) and transpose back, so output is bit-exact with
+// the scalar path.
+namespace {
+    inline uint32_t chacha_rotl(uint32_t x, int n) {
+        return (x << n) | (x >> (32 - n));
+    }
+    
+    inline void chacha_qr(uint32_t& a, uint32_t& b, uint32_t& c, uint32_t& d) {
+        a += b; d ^= a; d = chacha_rotl(d, 16);
+        c += d; b ^= c; b = chacha_rotl(b, 12);
+        a += b; d ^= a; d = chacha_rotl(d, 8);
+        c += d; b ^= c; b = chacha_rotl(b, 7);
+    }
+    
+    void chacha_blocks_scalar(const uint32_t* input, uint32_t* out, size_t blocks, int rounds) {
+        uint32_t x[16];
+        uint64_t ctr = static_cast<uint64_t>(input[12]) | (static_cast<uint64_t>(input[13]) << 32);
+        
+        for (size_t n = 0; n < blocks; ++n, ++ctr, out += 16) {
+            std::copy(input, input + 16, x);
+            x[12] = static_cast<uint32_t>(ctr);
+            x[13] = static_cast<uint32_t>(ctr >> 32);
+            
+            for (int i = 0; i < rounds; i += 2) {
+                chacha_qr(x[0], x[4], x[8], x[12]);
+                chacha_qr(x[1], x[5], x[9], x[13]);
+                chacha_qr(x[2], x[6], x[10], x[14]);
+                chacha_qr(x[3], x[7], x[11], x[15]);
+                
+                chacha_qr(x[0], x[5], x[10], x[15]);
+                chacha_qr(x[1], x[6], x[11], x[12]);
+                chacha_qr(x[2], x[7], x[8], x[13]);
+                chacha_qr(x[3], x[4], x[9], x[14]);
+            }
+            
+            for (int i = 0; i < 12; ++i) {
+                out[i] = x[i] + input[i];
+            }
+            out[12] = x[12] + static_cast<uint32_t>(ctr);
+            out[13] = x[13] + static_cast<uint32_t>(ctr >> 32);
+            out[14] = x[14] + input[14];
+            out[15] = x[15] + input[15];
+        }
+        
+        std::fill(x, x + 16, 0);
+    }
+    
+    // Per-lane counters for `lanes` blocks starting at input[12..13]
+    inline void chacha_lane_counters(const uint32_t* input, uint32_t* lo, uint32_t* hi, int lanes) {
+        uint64_t ctr = static_cast<uint64_t>(input[12]) | (static_cast<uint64_t>(input[13]) << 32);
+        for (int i = 0; i < lanes; ++i) {
+            lo[i] = static_cast<uint32_t>(ctr + i);
+            hi[i] = static_cast<uint32_t>((ctr + i) >> 32);
+        }
+    }
+    
+#if RANDOMIX_X86
+    // 4 blocks per call, rotations by shift since SSE2 has no byte shuffle
+    #define RANDOMIX_ROTL_SSE2(x, n) _mm_or_si128(_mm_slli_epi32(x, n), _mm_srli_epi32(x, 32 - (n)))
+    #define RANDOMIX_QR_SSE2(a, b, c, d) \
+        a = _mm_add_epi32(a, b); d = _mm_xor_si128(d, a); d = RANDOMIX_ROTL_SSE2(d, 16); \
+        c = _mm_add_epi32(c, d); b = _mm_xor_si128(b, c); b = RANDOMIX_ROTL_SSE2(b, 12); \
+        a = _mm_add_epi32(a, b); d = _mm_xor_si128(d, a); d = RANDOMIX_ROTL_SSE2(d, 8); \
+        c = _mm_add_epi32(c, d); b = _mm_xor_si128(b, c); b = RANDOMIX_ROTL_SSE2(b, 7)
+    
+    RANDOMIX_TARGET("sse2")
+    void chacha_blocks_sse2(const uint32_t* input, uint32_t* out, int rounds) {
+        alignas(16) uint32_t lo[4], hi[4];
+        chacha_lane_counters(input, lo, hi, 4);
+        
+        __m128i in[16], x[16];
+        for (int i = 0; i < 16; ++i) {
+            in[i] = _mm_set1_epi32(static_cast<int>(input[i]));
+        }
+        in[12] = _mm_load_si128(reinterpret_cast<const __m128i*>(lo));
+        in[13] = _mm_load_si128(reinterpret_cast<const __m128i*>(hi));
+        
+        for (int i = 0; i < 16; ++i) {
+            x[i] = in[i];
+        }
+        
+        for (int i = 0; i < rounds; i += 2) {
+            RANDOMIX_QR_SSE2(x[0], x[4], x[8], x[12]);
+            RANDOMIX_QR_SSE2(x[1], x[5], x[9], x[13]);
+            RANDOMIX_QR_SSE2(x[2], x[6], x[10], x[14]);
+            RANDOMIX_QR_SSE2(x[3], x[7], x[11], x[15]);
+            
+            RANDOMIX_QR_SSE2(x[0], x[5], x[10], x[15]);
+            RANDOMIX_QR_SSE2(x[1], x[6], x[11], x[12]);
+            RANDOMIX_QR_SSE2(x[2], x[7], x[8], x[13]);
+            RANDOMIX_QR_SSE2(x[3], x[4], x[9], x[14]);
+        }
+        
+        for (int i = 0; i < 16; ++i) {
+            x[i] = _mm_add_epi32(x[i], in[i]);
+        }
+        
+        // 4x4 transpose of each group of four words, one block per row
+        for (int g = 0; g < 16; g += 4) {
+            __m128i t0 = _mm_unpacklo_epi32(x[g], x[g + 1]);
+            __m128i t1 = _mm_unpackhi_epi32(x[g], x[g + 1]);
+            __m128i t2 = _mm_unpacklo_epi32(x[g + 2], x[g + 3]);
+            __m128i t3 = _mm_unpackhi_epi32(x[g + 2], x[g + 3]);
+            
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 0 * 16 + g), _mm_unpacklo_epi64(t0, t2));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 1 * 16 + g), _mm_unpackhi_epi64(t0, t2));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * 16 + g), _mm_unpacklo_epi64(t1, t3));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 3 * 16 + g), _mm_unpackhi_epi64(t1, t3));
+        }
+    }
+    
+    #undef RANDOMIX_QR_SSE2
+    #undef RANDOMIX_ROTL_SSE2
+    
+    // 8 blocks per call, 16/8-bit rotations done with a byte shuffle
+    #define RANDOMIX_ROTL_AVX2(x, n) _mm256_or_si256(_mm256_slli_epi32(x, n), _mm256_srli_epi32(x, 32 - (n)))
+    #define RANDOMIX_QR_AVX2(a, b, c, d) \
+        a = _mm256_add_epi32(a, b); d = _mm256_xor_si256(d, a); d = _mm256_shuffle_epi8(d, rot16); \
+        c = _mm256_add_epi32(c, d); b = _mm256_xor_si256(b, c); b = RANDOMIX_ROTL_AVX2(b, 12); \
+        a = _mm256_add_epi32(a, b); d = _mm256_xor_si256(d, a); d = _mm256_shuffle_epi8(d, rot8); \
+        c = _mm256_add_epi32(c, d); b = _mm256_xor_si256(b, c); b = RANDOMIX_ROTL_AVX2(b, 7)
+    
+    RANDOMIX_TARGET("avx2")
+    void chacha_blocks_avx2(const uint32_t* input, uint32_t* out, int rounds) {
+        alignas(32) uint32_t lo[8], hi[8];
+        chacha_lane_counters(input, lo, hi, 8);
+        
+        const __m256i rot16 = _mm256_setr_epi8(
+            2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+            2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+        const __m256i rot8 = _mm256_setr_epi8(
+            3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14,
+            3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14);
+        
+        __m256i in[16], x[16];
+        for (int i = 0; i < 16; ++i) {
+            in[i] = _mm256_set1_epi32(static_cast<int>(input[i]));
+        }
+        in[12] = _mm256_load_si256(reinterpret_cast<const __m256i*>(lo));
+        in[13] = _mm256_load_si256(reinterpret_cast<const __m256i*>(hi));
+        
+        for (int i = 0; i < 16; ++i) {
+            x[i] = in[i];
+        }
+        
+        for (int i = 0; i < rounds; i += 2) {
+            RANDOMIX_QR_AVX2(x[0], x[4], x[8], x[12]);
+            RANDOMIX_QR_AVX2(x[1], x[5], x[9], x[13]);
+            RANDOMIX_QR_AVX2(x[2], x[6], x[10], x[14]);
+            RANDOMIX_QR_AVX2(x[3], x[7], x[11], x[15]);
+            
+            RANDOMIX_QR_AVX2(x[0], x[5], x[10], x[15]);
+            RANDOMIX_QR_AVX2(x[1], x[6], x[11], x[12]);
+            RANDOMIX_QR_AVX2(x[2], x[7], x[8], x[13]);
+            RANDOMIX_QR_AVX2(x[3], x[4], x[9], x[14]);
+        }
+        
+        for (int i = 0; i < 16; ++i) {
+            x[i] = _mm256_add_epi32(x[i], in[i]);
+        }
+        
+        // 8x8 transpose of each half-block, one block per row
+        for (int g = 0; g < 16; g += 8) {
+            __m256i t0 = _mm256_unpacklo_epi32(x[g + 0], x[g + 1]);
+            __m256i t1 = _mm256_unpackhi_epi32(x[g + 0], x[g + 1]);
+            __m256i t2 = _mm256_unpacklo_epi32(x[g + 2], x[g + 3]);
+            __m256i t3 = _mm256_unpackhi_epi32(x[g + 2], x[g + 3]);
+            __m256i t4 = _mm256_unpacklo_epi32(x[g + 4], x[g + 5]);
+            __m256i t5 = _mm256_unpackhi_epi32(x[g + 4], x[g + 5]);
+            __m256i t6 = _mm256_unpacklo_epi32(x[g + 6], x[g + 7]);
+            __m256i t7 = _mm256_unpackhi_epi32(x[g + 6], x[g + 7]);
+            
+            __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+            __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+            __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+            __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+            __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+            __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+            __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+            __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+            
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 0 * 16 + g), _mm256_permute2x128_si256(u0, u4, 0x20));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 1 * 16 + g), _mm256_permute2x128_si256(u1, u5, 0x20));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 2 * 16 + g), _mm256_permute2x128_si256(u2, u6, 0x20));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 3 * 16 + g), _mm256_permute2x128_si256(u3, u7, 0x20));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 4 * 16 + g), _mm256_permute2x128_si256(u0, u4, 0x31));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 5 * 16 + g), _mm256_permute2x128_si256(u1, u5, 0x31));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 6 * 16 + g), _mm256_permute2x128_si256(u2, u6, 0x31));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 7 * 16 + g), _mm256_permute2x128_si256(u3, u7, 0x31));
+        }
+    }
+    
+    #undef RANDOMIX_QR_AVX2
+    #undef RANDOMIX_ROTL_AVX2
+    
+    // 16 blocks per call with native 32-bit rotates
+    #define RANDOMIX_QR_AVX512(a, b, c, d) \
+        a = _mm512_add_epi32(a, b); d = _mm512_xor_si512(d, a); d = _mm512_rol_epi32(d, 16); \
+        c = _mm512_add_epi32(c, d); b = _mm512_xor_si512(b, c); b = _mm512_rol_epi32(b, 12); \
+        a = _mm512_add_epi32(a, b); d = _mm512_xor_si512(d, a); d = _mm512_rol_epi32(d, 8); \
+        c = _mm512_add_epi32(c, d); b = _mm512_xor_si512(b, c); b = _mm512_rol_epi32(b, 7)
+    
+    RANDOMIX_TARGET("avx512f")
+    void chacha_blocks_avx512(const uint32_t* input, uint32_t* out, int rounds) {
+        alignas(64) uint32_t lo[16], hi[16];
+        chacha_lane_counters(input, lo, hi, 16);
+        
+        __m512i in[16], x[16];
+        for (int i = 0; i < 16; ++i) {
+            in[i] = _mm512_set1_epi32(static_cast<int>(input[i]));
+        }
+        in[12] = _mm512_load_si512(lo);
+        in[13] = _mm512_load_si512(hi);
+        
+        for (int i = 0; i < 16; ++i) {
+            x[i] = in[i];
+        }
+        
+        for (int i = 0; i < rounds; i += 2) {
+            RANDOMIX_QR_AVX512(x[0], x[4], x[8], x[12]);
+            RANDOMIX_QR_AVX512(x[1], x[5], x[9], x[13]);
+            RANDOMIX_QR_AVX512(x[2], x[6], x[10], x[14]);
+            RANDOMIX_QR_AVX512(x[3], x[7], x[11], x[15]);
+            
+            RANDOMIX_QR_AVX512(x[0], x[5], x[10], x[15]);
+            RANDOMIX_QR_AVX512(x[1], x[6], x[11], x[12]);
+            RANDOMIX_QR_AVX512(x[2], x[7], x[8], x[13]);
+            RANDOMIX_QR_AVX512(x[3], x[4], x[9], x[14]);
+        }
+        
+        for (int i = 0; i < 16; ++i) {
+            x[i] = _mm512_add_epi32(x[i], in[i]);
+        }
+        
+        // 4x4 transpose inside each 128-bit lane, then regroup the lanes
+        __m512i a[4][4];
+        for (int g = 0; g < 4; ++g) {
+            __m512i t0 = _mm512_unpacklo_epi32(x[g * 4 + 0], x[g * 4 + 1]);
+            __m512i t1 = _mm512_unpackhi_epi32(x[g * 4 + 0], x[g * 4 + 1]);
+            __m512i t2 = _mm512_unpacklo_epi32(x[g * 4 + 2], x[g * 4 + 3]);
+            __m512i t3 = _mm512_unpackhi_epi32(x[g * 4 + 2], x[g * 4 + 3]);
+            
+            a[g][0] = _mm512_unpacklo_epi64(t0, t2);
+            a[g][1] = _mm512_unpackhi_epi64(t0, t2);
+            a[g][2] = _mm512_unpacklo_epi64(t1, t3);
+            a[g][3] = _mm512_unpackhi_epi64(t1, t3);
+        }
+        
+        for (int j = 0; j < 4; ++j) {
+            __m512i p0 = _mm512_shuffle_i32x4(a[0][j], a[1][j], 0x44);
+            __m512i p1 = _mm512_shuffle_i32x4(a[0][j], a[1][j], 0xEE);
+            __m512i p2 = _mm512_shuffle_i32x4(a[2][j], a[3][j], 0x44);
+            __m512i p3 = _mm512_shuffle_i32x4(a[2][j], a[3][j], 0xEE);
+            
+            _mm512_storeu_si512(out + (0 * 4 + j) * 16, _mm512_shuffle_i32x4(p0, p2, 0x88));
+            _mm512_storeu_si512(out + (1 * 4 + j) * 16, _mm512_shuffle_i32x4(p0, p2, 0xDD));
+            _mm512_storeu_si512(out + (2 * 4 + j) * 16, _mm512_shuffle_i32x4(p1, p3, 0x88));
+            _mm512_storeu_si512(out + (3 * 4 + j) * 16, _mm512_shuffle_i32x4(p1, p3, 0xDD));
+        }
+    }
+    
+    #undef RANDOMIX_QR_AVX512
+#endif
+    
+    // Fills `blocks` blocks from `input`, widest kernel first
+    void chacha_blocks(const uint32_t* input, uint32_t* out, size_t blocks, int rounds) {
+        uint32_t s[16];
+        std::copy(input, input + 16, s);
+        uint64_t ctr = static_cast<uint64_t>(s[12]) | (static_cast<uint64_t>(s[13]) << 32);
+        
+        auto advance = [&](size_t n) {
+            ctr += n;
+            s[12] = static_cast<uint32_t>(ctr);
+            s[13] = static_cast<uint32_t>(ctr >> 32);
+            out += n * 16;
+            blocks -= n;
+        };
+        
+#if RANDOMIX_X86
+        SimdLevel level = simd_level();
+        
+        while (level >= SIMD_AVX512 && blocks >= 16) {
+            chacha_blocks_avx512(s, out, rounds);
+            advance(16);
+        }
+        while (level >= SIMD_AVX2 && blocks >= 8) {
+            chacha_blocks_avx2(s, out, rounds);
+            advance(8);
+        }
+        while (level >= SIMD_SSE2 && blocks >= 4) {
+            chacha_blocks_sse2(s, out, rounds);
+            advance(4);
+        }
+#endif
+        
+        if (blocks > 0) {
+            chacha_blocks_scalar(s, out, blocks, rounds);
+        }
+        
+        std::fill(s, s + 16, 0);
+    }
 }
 
 // ChaChaRNG Implementation
-inline uint32_t ChaChaRNG::rotl32(uint32_t x, int n) {
+template <int ROUNDS>
+inline uint32_t BasicChaChaRNG<ROUNDS>::rotl32(uint32_t x, int n) {
     return (x << n) | (x >> (32 - n));
 }
 
-void ChaChaRNG::quarter_round(uint32_t& a, uint32_t& b, uint32_t& c, uint32_t& d) {
+template <int ROUNDS>
+void BasicChaChaRNG<ROUNDS>::quarter_round(uint32_t& a, uint32_t& b, uint32_t& c, uint32_t& d) {
     a += b; d ^= a; d = rotl32(d, 16);
     c += d; b ^= c; b = rotl32(b, 12);
     a += b; d ^= a; d = rotl32(d, 8);
     c += d; b ^= c; b = rotl32(b, 7);
 }
 
-uint64_t ChaChaRNG::get_os_entropy() {
+template <int ROUNDS>
+uint64_t BasicChaChaRNG<ROUNDS>::get_os_entropy() {
     uint64_t entropy = 0;
     
     #ifdef _WIN32
@@ -114,34 +2071,31 @@ uint64_t ChaChaRNG::get_os_entropy() {
     return entropy;
 }
 
-void ChaChaRNG::generate_block() {
-    std::copy(state.begin(), state.end(), block);
+template <int ROUNDS>
+void BasicChaChaRNG<ROUNDS>::generate_block() {
+    chacha_blocks(state.data(), block, BUFFER_BLOCKS, ROUNDS);
     
-    for (int i = 0; i < ROUNDS; i += 2) {
-        quarter_round(block[0], block[4], block[8], block[12]);
-        quarter_round(block[1], block[5], block[9], block[13]);
-        quarter_round(block[2], block[6], block[10], block[14]);
-        quarter_round(block[3], block[7], block[11], block[15]);
-        
-        quarter_round(block[0], block[5], block[10], block[15]);
-        quarter_round(block[1], block[6], block[11], block[12]);
-        quarter_round(block[2], block[7], block[8], block[13]);
-        quarter_round(block[3], block[4], block[9], block[14]);
-    }
+    counter += BUFFER_BLOCKS;
+    state[12] = static_cast<uint32_t>(counter);
+    state[13] = static_cast<uint32_t>(counter >> 32);
     
-    for (int i = 0; i < 16; ++i) {
-        block[i] += state[i];
-    }
+    bytes_generated += 64 * BUFFER_BLOCKS;
+    position = 0;
+}
+
+template <int ROUNDS>
+void BasicChaChaRNG<ROUNDS>::generate_direct(uint32_t* out, size_t blocks) {
+    chacha_blocks(state.data(), out, blocks, ROUNDS);
     
-    counter++;
+    counter += blocks;
     state[12] = static_cast<uint32_t>(counter);
     state[13] = static_cast<uint32_t>(counter >> 32);
     
-    bytes_generated += 64;
-    position = 0;
+    bytes_generated += 64 * blocks;
 }
 
-void ChaChaRNG::check_reseed() {
+template <int ROUNDS>
+void BasicChaChaRNG<ROUNDS>::check_reseed() {
     if (bytes_generated >= RESEED_THRESHOLD) {
         uint64_t os_entropy = get_os_entropy();
         if (os_entropy != 0) {
@@ -152,7 +2106,8 @@ void ChaChaRNG::check_reseed() {
     }
 }
 
-void ChaChaRNG::expand_seed(uint64_t seed, uint32_t* output, size_t count) {
+template <int ROUNDS>
+void BasicChaChaRNG<ROUNDS>::expand_seed(uint64_t seed, uint32_t* output, size_t count) {
     std::array<uint32_t, 16> temp_state;
     std::copy(CONSTANTS, CONSTANTS + 4, temp_state.begin());
     
@@ -207,7 +2162,8 @@ void ChaChaRNG::expand_seed(uint64_t seed, uint32_t* output, size_t count) {
     std::fill(temp_block, temp_block + 16, 0);
 }
 
-ChaChaRNG::ChaChaRNG(uint64_t seed) {
+template <int ROUNDS>
+BasicChaChaRNG<ROUNDS>::BasicChaChaRNG(uint64_t seed) {
     bytes_generated = 0;
     
     if (seed == 0) {
@@ -243,10 +2199,11 @@ ChaChaRNG::ChaChaRNG(uint64_t seed) {
     
     std::fill(expanded, expanded + 12, 0);
     
-    position = 16;
+    position = BUFFER_WORDS;
 }
 
-void ChaChaRNG::seed(uint64_t seed) {
+template <int ROUNDS>
+void BasicChaChaRNG<ROUNDS>::seed(uint64_t seed) {
     counter = 0;
     bytes_generated = 0;
     std::copy(CONSTANTS, CONSTANTS + 4, state.begin());
@@ -261,23 +2218,26 @@ void ChaChaRNG::seed(uint64_t seed) {
     state[13] = 0;
     
     std::fill(expanded, expanded + 12, 0);
-    position = 16;
+    position = BUFFER_WORDS;
 }
 
-uint32_t ChaChaRNG::next_uint32() {
+template <int ROUNDS>
+uint32_t BasicChaChaRNG<ROUNDS>::next_uint32() {
     check_reseed();
-    if (position >= 16) {
+    if (position >= BUFFER_WORDS) {
         generate_block();
     }
     return block[position++];
 }
 
-float ChaChaRNG::next_float() {
+template <int ROUNDS>
+float BasicChaChaRNG<ROUNDS>::next_float() {
     uint32_t val = next_uint32() >> 8;
     return static_cast<float>(val) / 16777216.0f;
 }
 
-uint32_t ChaChaRNG::next_bounded(uint32_t bound) {
+template <int ROUNDS>
+uint32_t BasicChaChaRNG<ROUNDS>::next_bounded(uint32_t bound) {
     if (bound == 0) return 0;
     if (bound == 1) return 0;
     
@@ -295,27 +2255,128 @@ uint32_t ChaChaRNG::next_bounded(uint32_t bound) {
     return static_cast<uint32_t>(m >> 32);
 }
 
-void ChaChaRNG::next_bytes(uint8_t* buffer, size_t length) {
-    for (size_t i = 0; i < length; i += 4) {
-        uint32_t val = next_uint32();
-        size_t to_copy = std::min(static_cast<size_t>(4), length - i);
-        std::memcpy(buffer + i, &val, to_copy);
+template <int ROUNDS>
+void BasicChaChaRNG<ROUNDS>::next_bytes(uint8_t* buffer, size_t length) {
+    // Same keystream as repeated next_uint32 calls, but copied a buffer at a
+    // time with one reseed check per refill or direct batch
+    while (length > 0) {
+        if (position >= BUFFER_WORDS) {
+            check_reseed();
+            
+            // Large word-aligned requests skip the buffer entirely
+            bool aligned = reinterpret_cast<uintptr_t>(buffer) % alignof(uint32_t) == 0;
+            if (aligned && length >= sizeof(block)) {
+                size_t blocks = std::min(length / 64, DIRECT_BATCH_BLOCKS);
+                generate_direct(reinterpret_cast<uint32_t*>(buffer), blocks);
+                buffer += blocks * 64;
+                length -= blocks * 64;
+                continue;
+            }
+            
+            generate_block();
+        }
+        
+        size_t available = static_cast<size_t>(BUFFER_WORDS - position) * 4;
+        size_t to_copy = std::min(available, length);
+        std::memcpy(buffer, reinterpret_cast<const uint8_t*>(block) + position * 4, to_copy);
+        
+        // A trailing partial word is discarded, as with next_uint32
+        position += static_cast<int>((to_copy + 3) / 4);
+        buffer += to_copy;
+        length -= to_copy;
     }
 }
 
-ChaChaRNG::~ChaChaRNG() {
+template <int ROUNDS>
+void BasicChaChaRNG<ROUNDS>::fill(uint32_t* out, size_t count) {
+    next_bytes(reinterpret_cast<uint8_t*>(out), count * sizeof(uint32_t));
+}
+
+template <int ROUNDS>
+BasicChaChaRNG<ROUNDS>::~BasicChaChaRNG() {
     std::fill(state.begin(), state.end(), 0);
-    std::fill(block, block + 16, 0);
+    std::fill(block, block + BUFFER_WORDS, 0);
     counter = 0;
     bytes_generated = 0;
     position = 0;
 }
 
+template class BasicChaChaRNG<8>;
+template class BasicChaChaRNG<12>;
+template class BasicChaChaRNG<20>;
+
+// ScriptContext Implementation
+namespace {
+    PRNGEngine make_engine(EngineKind engine, uint64_t seed, uint64_t stream) {
+        PRNGEngine rng;
+        switch (engine) {
+        case EngineKind::Xoshiro256pp:
+            rng.emplace<Xoshiro256pp>();
+            break;
+        case EngineKind::SFC64:
+            rng.emplace<SFC64>();
+            break;
+        case EngineKind::WyRand:
+            rng.emplace<WyRand>();
+            break;
+        case EngineKind::PCG32x8:
+            rng.emplace<PCG32x8>();
+            break;
+        default:
+            rng.emplace<PCG32>();
+            break;
+        }
+        std::visit([&](auto& generator) { generator.seed(seed, stream); }, rng);
+        return rng;
+    }
+}
+
+ScriptContext::ScriptContext(EngineKind engine, uint64_t seed, uint64_t stream)
+    : prng(make_engine(engine, seed, stream)), prng64(seed, stream), stream(stream) {}
+
+void ScriptContext::set_engine(EngineKind engine, uint64_t seed) {
+    prng = make_engine(engine, seed, stream);
+}
+
+const DiceExpression* ScriptContext::dice(const std::string& text) {
+    auto it = dice_cache.find(text);
+    if (it != dice_cache.end()) return &it->second;
+    
+    DiceExpression expr;
+    if (!expr.parse(text.c_str())) return nullptr;
+    
+    if (dice_cache.size() >= DICE_CACHE_SIZE) dice_cache.clear();
+    return &dice_cache.emplace(text, std::move(expr)).first->second;
+}
+
+void ScriptContext::seed(uint64_t seed) {
+    std::visit([&](auto& rng) { rng.seed(seed); }, prng);
+    prng64.seed(seed);
+}
+
+void ScriptContext::seed(uint64_t seed, uint64_t stream) {
+    std::visit([&](auto& rng) { rng.seed(seed, stream); }, prng);
+    prng64.seed(seed, stream);
+    this->stream = stream;
+}
+
 // Global Random Generators Implementation
 namespace RandomixGenerators {
     std::mutex prng_mutex;
     std::mutex csprng_mutex;
     
+    namespace {
+        std::unordered_map<const void*, std::unique_ptr<ScriptContext>> contexts;
+        const void* last_script = nullptr;
+        ScriptContext* last_context = nullptr;
+        uint64_t base_seed = 0;
+        uint64_t script_sequence = 0;
+        EngineKind default_engine = EngineKind::PCG32;
+        std::atomic<uint64_t> thread_sequence(0);
+        
+        const char* const engine_names[] = { "pcg32", "xoshiro256pp", "sfc64", "wyrand", "pcg32x8" };
+    }
+    
     PCG32& GetPRNG() {
         static PCG32 instance(0);
         return instance;
@@ -326,13 +2387,92 @@ namespace RandomixGenerators {
         return instance;
     }
     
+    PCG32& GetThreadPRNG() {
+        // Each thread takes its own stream (increment), so sequences can't overlap
+        thread_local uint64_t thread_stream = ++thread_sequence;
+        thread_local uint64_t thread_seed = time_seed() ^ (thread_stream << 32);
+        thread_local PCG32 instance(splitmix64(thread_seed), thread_stream);
+        return instance;
+    }
+    
+    ChaChaRNG& GetThreadCSPRNG() {
+        // Seed 0 pulls a fresh key from OS entropy for every thread
+        thread_local ChaChaRNG instance(0);
+        return instance;
+    }
+    
     void SeedPRNG(uint64_t seed) {
-        std::lock_guard<std::mutex> lock(prng_mutex);
-        GetPRNG().seed(seed);
+        Access<PCG32> rng;
+        rng->seed(seed);
+        base_seed = seed;
     }
     
     void SeedCSPRNG(uint64_t seed) {
-        std::lock_guard<std::mutex> lock(csprng_mutex);
-        GetCSPRNG().seed(seed);
+        Access<ChaChaRNG> rng;
+        rng->seed(seed);
+    }
+    
+    ScriptContext& CreateContext(const void* script) {
+        if (base_seed == 0) {
+            base_seed = time_seed();
+        }
+        
+        // Each script runs on its own stream, not just its own start point
+        uint64_t stream = ++script_sequence;
+        uint64_t sequence = base_seed + stream;
+        uint64_t seed = splitmix64(sequence);
+        auto& slot = contexts[script];
+        slot.reset(new ScriptContext(default_engine, seed, stream));
+        
+        last_script = script;
+        last_context = slot.get();
+        return *last_context;
+    }
+    
+    void DestroyContext(const void* script) {
+        if (last_script == script) {
+            last_script = nullptr;
+            last_context = nullptr;
+        }
+        contexts.erase(script);
+    }
+    
+    ScriptContext& GetContext(const void* script) {
+        if (script == last_script) {
+            return *last_context;
+        }
+        
+        auto it = contexts.find(script);
+        if (it == contexts.end()) {
+            return CreateContext(script);
+        }
+        
+        last_script = script;
+        last_context = it->second.get();
+        return *last_context;
+    }
+    
+    void SetDefaultEngine(EngineKind engine) {
+        default_engine = engine;
+    }
+    
+    EngineKind GetDefaultEngine() {
+        return default_engine;
     }
-}
\ No newline at end of file
+    
+    bool ParseEngineName(const char* name, EngineKind& engine) {
+        if (!name) return false;
+        
+        for (int i = 0; i < static_cast<int>(std::variant_size<PRNGEngine>::value); ++i) {
+            if (std::strcmp(name, engine_names[i]) == 0) {
+                engine = static_cast<EngineKind>(i);
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    const char* EngineName(EngineKind engine) {
+        return engine_names[static_cast<int>(engine)];
+    }
+}
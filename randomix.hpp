@@ -1,8 +1,84 @@
 #pragma once
 
+#include <climits>
 #include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
 #include <array>
+#include <cmath>
+#include <functional>
+#include <memory>
 #include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <variant>
+#include <vector>
+
+// Engine concept shared by every PRNG the PRand* natives can run on:
+//   uint32_t next_uint32();
+//   uint64_t next_uint64();
+//   float next_float();                      // [0, 1)
+//   uint32_t next_bounded(uint32_t bound);   // [0, bound), unbiased
+//   void fill(uint32_t* out, size_t count);  // same words as count next_uint32 calls
+//   void seed(uint64_t seed);
+//   void seed(uint64_t seed, uint64_t stream);
+
+namespace RandomixDetail {
+    // Lemire's nearly divisionless bounded draw on top of next_uint32
+    template <typename Engine>
+    uint32_t bounded(Engine& rng, uint32_t bound) {
+        if (bound == 0) return 0;
+        
+        uint64_t m = static_cast<uint64_t>(rng.next_uint32()) * static_cast<uint64_t>(bound);
+        uint32_t leftover = static_cast<uint32_t>(m);
+        
+        if (leftover < bound) {
+            uint32_t threshold = (0u - bound) % bound;
+            while (leftover < threshold) {
+                m = static_cast<uint64_t>(rng.next_uint32()) * static_cast<uint64_t>(bound);
+                leftover = static_cast<uint32_t>(m);
+            }
+        }
+        
+        return static_cast<uint32_t>(m >> 32);
+    }
+    
+    template <typename Engine>
+    void fill(Engine& rng, uint32_t* out, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = rng.next_uint32();
+        }
+    }
+    
+    // count draws in [0, bound): raw words are produced in one run, then
+    // reduced with Lemire's method, redrawing only the rare rejected words
+    template <typename Engine>
+    void fill_bounded(Engine& rng, uint32_t* out, size_t count, uint32_t bound) {
+        if (bound == 0) {
+            std::fill(out, out + count, 0u);
+            return;
+        }
+        
+        rng.fill(out, count);
+        
+        uint32_t threshold = (0u - bound) % bound;
+        for (size_t i = 0; i < count; ++i) {
+            uint64_t m = static_cast<uint64_t>(out[i]) * static_cast<uint64_t>(bound);
+            while (static_cast<uint32_t>(m) < threshold) {
+                m = static_cast<uint64_t>(rng.next_uint32()) * static_cast<uint64_t>(bound);
+            }
+            out[i] = static_cast<uint32_t>(m >> 32);
+        }
+    }
+    
+    // 24 high bits of a 64-bit draw, exactly representable in a float
+    inline float float_from_u64(uint64_t x) {
+        return static_cast<float>(x >> 40) / 16777216.0f;
+    }
+}
 
 // PCG32 - Fast Random Generator
 class PCG32 {
@@ -15,22 +91,1354 @@ private:
     
 public:
     PCG32(uint64_t seed = 0);
+    // Selects one of 2^63 independent streams (the LCG increment)
+    PCG32(uint64_t seed, uint64_t stream);
     void seed(uint64_t seed);
+    void seed(uint64_t seed, uint64_t stream);
+    // Jump forward/back by delta outputs in O(log delta)
+    void advance(uint64_t delta);
+    void backstep(uint64_t delta);
     uint32_t next_uint32();
+    uint64_t next_uint64();
     float next_float();
     uint32_t next_bounded(uint32_t bound);
+    void fill(uint32_t* out, size_t count);
+};
+
+// xoshiro256++ - Blackman/Vigna, 256-bit state
+class Xoshiro256pp {
+private:
+    uint64_t s[4];
+    
+public:
+    Xoshiro256pp(uint64_t seed = 0);
+    void seed(uint64_t seed);
+    void seed(uint64_t seed, uint64_t stream);
+    uint64_t next_uint64();
+    uint32_t next_uint32() { return static_cast<uint32_t>(next_uint64() >> 32); }
+    float next_float() { return RandomixDetail::float_from_u64(next_uint64()); }
+    uint32_t next_bounded(uint32_t bound) { return RandomixDetail::bounded(*this, bound); }
+    void fill(uint32_t* out, size_t count) { RandomixDetail::fill(*this, out, count); }
+};
+
+// SFC64 - Chris Doty-Humphrey's Small Fast Chaotic generator
+class SFC64 {
+private:
+    uint64_t a, b, c, counter;
+    
+public:
+    SFC64(uint64_t seed = 0);
+    void seed(uint64_t seed);
+    void seed(uint64_t seed, uint64_t stream);
+    uint64_t next_uint64();
+    uint32_t next_uint32() { return static_cast<uint32_t>(next_uint64() >> 32); }
+    float next_float() { return RandomixDetail::float_from_u64(next_uint64()); }
+    uint32_t next_bounded(uint32_t bound) { return RandomixDetail::bounded(*this, bound); }
+    void fill(uint32_t* out, size_t count) { RandomixDetail::fill(*this, out, count); }
+};
+
+// wyrand - Wang Yi's 64-bit multiply-mix generator
+class WyRand {
+private:
+    uint64_t state;
+    
+public:
+    WyRand(uint64_t seed = 0);
+    void seed(uint64_t seed);
+    void seed(uint64_t seed, uint64_t stream);
+    uint64_t next_uint64();
+    uint32_t next_uint32() { return static_cast<uint32_t>(next_uint64() >> 32); }
+    float next_float() { return RandomixDetail::float_from_u64(next_uint64()); }
+    uint32_t next_bounded(uint32_t bound) { return RandomixDetail::bounded(*this, bound); }
+    void fill(uint32_t* out, size_t count) { RandomixDetail::fill(*this, out, count); }
+};
+
+// PCG32x8 - 8 independent PCG32 lanes stepped together (AVX2 when available)
+// into a cache-aligned buffer, so most draws are a single load
+class PCG32x8 {
+private:
+    static constexpr int LANES = 8;
+    // 4 KB, 128 steps per lane
+    static constexpr int BUFFER_WORDS = 1024;
+    
+    alignas(64) uint64_t state[LANES];
+    alignas(64) uint64_t inc[LANES];
+    alignas(64) uint32_t buffer[BUFFER_WORDS];
+    int position;
+    
+    void refill();
+    
+public:
+    PCG32x8(uint64_t seed = 0);
+    void seed(uint64_t seed);
+    void seed(uint64_t seed, uint64_t stream);
+    
+    uint32_t next_uint32() {
+        if (position >= BUFFER_WORDS) refill();
+        return buffer[position++];
+    }
+    
+    uint64_t next_uint64() {
+        uint64_t hi = next_uint32();
+        return (hi << 32) | next_uint32();
+    }
+    
+    float next_float() { return static_cast<float>(next_uint32() >> 8) / 16777216.0f; }
+    uint32_t next_bounded(uint32_t bound) { return RandomixDetail::bounded(*this, bound); }
+    void fill(uint32_t* out, size_t count);
+};
+
+// Engines selectable for the PRand* natives, in EngineKind order
+enum class EngineKind {
+    PCG32 = 0,
+    Xoshiro256pp = 1,
+    SFC64 = 2,
+    WyRand = 3,
+    PCG32x8 = 4
+};
+
+using PRNGEngine = std::variant<PCG32, Xoshiro256pp, SFC64, WyRand, PCG32x8>;
+
+// PCG64-DXSM - 128-bit state, native 64-bit and double outputs
+class PCG64 {
+private:
+    uint64_t state_hi, state_lo;
+    uint64_t inc_hi, inc_lo;
+    
+    static constexpr uint64_t CHEAP_MULTIPLIER = 0xda942042e4dd58b5ULL;
+    static constexpr uint64_t STREAM = 0xda3e39cb94b95bdbULL;
+    
+    void step();
+    
+public:
+    PCG64(uint64_t seed = 0);
+    PCG64(uint64_t seed, uint64_t stream);
+    void seed(uint64_t seed);
+    void seed(uint64_t seed, uint64_t stream);
+    uint64_t next_uint64();
+    uint32_t next_uint32();
+    float next_float();
+    double next_double();
+    uint32_t next_bounded(uint32_t bound);
+    uint64_t next_bounded64(uint64_t bound);
+};
+
+// Philox4x32-10 - Salmon et al. counter-based generator
+// Stateless: every value is a pure function of (key, counter, index), so the
+// same inputs give the same output in any order, on any thread, with no lock.
+// Word `index` of a keyed stream is word index % 4 of block
+// {counter, index / 4} under key.
+class Philox4x32 {
+public:
+    using Block = std::array<uint32_t, 4>;
+    
+    static Block generate(uint64_t key, uint64_t counter, uint64_t block);
+    static uint32_t word(uint64_t key, uint64_t counter, uint64_t index);
+    static float word_float(uint64_t key, uint64_t counter, uint64_t index);
+    // [0, bound), unbiased; rejected words are replaced from a side stream
+    // keyed by index, so the result still depends only on the inputs
+    static uint32_t bounded(uint64_t key, uint64_t counter, uint64_t index, uint32_t bound);
+    
+    // Words [0, count) of the stream, 8 blocks at a time with AVX2
+    static void fill(uint32_t* out, size_t count, uint64_t key, uint64_t counter);
+    static void fill_bounded(uint32_t* out, size_t count, uint64_t key, uint64_t counter, uint32_t bound);
+};
+
+// Batch point kernels, engine independent. `words` holds one plane of
+// `count` raw 32-bit draws per random input (input k of point i is
+// words[k * count + i]); points go to separate X/Y/Z arrays. All shapes are
+// rejection-free and run 8 points at a time with AVX2.
+namespace RandomixGeometry {
+    // Planes of raw draws each kernel reads
+    constexpr size_t DISC_DRAWS = 2;
+    constexpr size_t CIRCLE_EDGE_DRAWS = 1;
+    constexpr size_t RECT_DRAWS = 2;
+    constexpr size_t SPHERE_DRAWS = 3;
+    constexpr size_t SPHERE_SURFACE_DRAWS = 2;
+    constexpr size_t BOX_DRAWS = 3;
+    
+    // x = cx + sx * r * cos(t), y = cy + sy * r * sin(t), r = sqrt(r0 + u * dr)
+    // covers circles (sx = sy = radius), ellipses and rings (r0 = inner^2)
+    void disc(const uint32_t* words, size_t count, float cx, float cy, float sx, float sy,
+        float r0, float dr, float* x, float* y);
+    void circle_edge(const uint32_t* words, size_t count, float cx, float cy, float radius, float* x, float* y);
+    void rect(const uint32_t* words, size_t count, float minX, float minY, float maxX, float maxY, float* x, float* y);
+    void sphere(const uint32_t* words, size_t count, float cx, float cy, float cz, float radius,
+        float* x, float* y, float* z);
+    void sphere_surface(const uint32_t* words, size_t count, float cx, float cy, float cz, float radius,
+        float* x, float* y, float* z);
+    void box(const uint32_t* words, size_t count, float minX, float minY, float minZ,
+        float maxX, float maxY, float maxZ, float* x, float* y, float* z);
+}
+
+// Standard normal deviates by the Ziggurat method (Marsaglia & Tsang,
+// 128 layers). One 32-bit draw, a compare and a multiply on ~99% of calls;
+// log/exp are only reached in the wedges and the tail.
+namespace RandomixNormal {
+    constexpr int LAYERS = 128;
+    // Start of the tail (right edge of the base layer)
+    constexpr float TAIL = 3.442620f;
+    
+    struct Tables {
+        uint32_t kn[LAYERS];  // fast-path thresholds on |hz|
+        float wn[LAYERS];     // hz -> x scale per layer
+        float fn[LAYERS];     // exp(-x^2 / 2) at each layer edge
+    };
+    
+    extern const Tables ZIGGURAT;
+    
+    // (0, 1), never 0 so it is safe under log
+    template <typename Engine>
+    float open_unit(Engine& rng) {
+        return (static_cast<float>(rng.next_uint32() >> 8) + 0.5f) / 16777216.0f;
+    }
+    
+    // Slow path for a word that missed the fast test
+    template <typename Engine>
+    float ziggurat_fix(Engine& rng, uint32_t word) {
+        const Tables& t = ZIGGURAT;
+        
+        for (;;) {
+            int32_t hz = static_cast<int32_t>(word);
+            uint32_t iz = word & (LAYERS - 1);
+            float x = static_cast<float>(hz) * t.wn[iz];
+            
+            if (iz == 0) {
+                // Tail beyond TAIL (Marsaglia's exponential method)
+                float xt, yt;
+                do {
+                    xt = -std::log(open_unit(rng)) / TAIL;
+                    yt = -std::log(open_unit(rng));
+                } while (yt + yt < xt * xt);
+                return hz > 0 ? TAIL + xt : -TAIL - xt;
+            }
+            
+            if (t.fn[iz] + open_unit(rng) * (t.fn[iz - 1] - t.fn[iz]) < std::exp(-0.5f * x * x)) {
+                return x;
+            }
+            
+            word = rng.next_uint32();
+            hz = static_cast<int32_t>(word);
+            iz = word & (LAYERS - 1);
+            uint32_t mag = hz < 0 ? 0u - static_cast<uint32_t>(hz) : static_cast<uint32_t>(hz);
+            if (mag < t.kn[iz]) return static_cast<float>(hz) * t.wn[iz];
+        }
+    }
+    
+    // Decodes one raw word, falling back to ziggurat_fix on a miss
+    template <typename Engine>
+    float from_word(Engine& rng, uint32_t word) {
+        const Tables& t = ZIGGURAT;
+        int32_t hz = static_cast<int32_t>(word);
+        uint32_t iz = word & (LAYERS - 1);
+        uint32_t mag = hz < 0 ? 0u - static_cast<uint32_t>(hz) : static_cast<uint32_t>(hz);
+        
+        if (mag < t.kn[iz]) return static_cast<float>(hz) * t.wn[iz];
+        return ziggurat_fix(rng, word);
+    }
+    
+    template <typename Engine>
+    float next(Engine& rng) {
+        return from_word(rng, rng.next_uint32());
+    }
+    
+    // count deviates scaled to mean/stddev and clamped to [lo, hi], written
+    // as float bits so `out` can be a Pawn array. The raw words are produced
+    // in one run into `out` itself; only misses draw more from the engine.
+    template <typename Engine>
+    void fill(Engine& rng, uint32_t* out, size_t count, float mean, float stddev, float lo, float hi) {
+        rng.fill(out, count);
+        
+        for (size_t i = 0; i < count; ++i) {
+            float value = std::min(std::max(mean + from_word(rng, out[i]) * stddev, lo), hi);
+            std::memcpy(&out[i], &value, sizeof(value));
+        }
+    }
+}
+
+// Vose alias table: O(n) build, O(1) weighted pick. Column i keeps its own
+// index when a 32-bit draw falls under prob[i] and yields alias[i]
+// otherwise; full columns alias to themselves.
+class AliasTable {
+private:
+    std::vector<uint32_t> prob;
+    std::vector<uint32_t> alias;
+    
+public:
+    // Non-positive weights are never picked; fails if no weight is positive
+    bool build(const int32_t* weights, size_t count);
+    bool build(const double* weights, size_t count);
+    
+    size_t size() const { return prob.size(); }
+    
+    template <typename Engine>
+    uint32_t pick(Engine& rng) const {
+        uint32_t column = rng.next_bounded(static_cast<uint32_t>(prob.size()));
+        return rng.next_uint32() < prob[column] ? column : alias[column];
+    }
+};
+
+// Mutable weighted set: a Fenwick tree over non-negative integer weights,
+// O(log n) to change a weight or pick, O(n) to build from an array
+class WeightedSet {
+private:
+    std::vector<uint32_t> weights;
+    std::vector<uint64_t> tree;  // 1-based Fenwick sums
+    uint64_t total_weight = 0;
+    size_t top_step = 0;         // highest power of two <= size
+    
+    void update(size_t index, int64_t delta);
+    
+public:
+    // Largest set the natives will create
+    static constexpr size_t MAX_SIZE = 1 << 24;
+    
+    explicit WeightedSet(size_t count);
+    // Non-positive weights count as 0
+    void assign(const int32_t* values, size_t count);
+    
+    size_t size() const { return weights.size(); }
+    uint64_t total() const { return total_weight; }
+    uint32_t weight(size_t index) const { return weights[index]; }
+    void set_weight(size_t index, uint32_t weight);
+    
+    // Index whose cumulative range holds target, target in [0, total)
+    size_t find(uint64_t target) const;
+    
+    // Caller checks total() > 0
+    template <typename Engine>
+    size_t pick(Engine& rng) const {
+        if (total_weight <= UINT32_MAX) {
+            return find(rng.next_bounded(static_cast<uint32_t>(total_weight)));
+        }
+        
+        // Past 32 bits: mask to the next power of two and reject
+        uint64_t mask = total_weight - 1;
+        mask |= mask >> 1; mask |= mask >> 2; mask |= mask >> 4;
+        mask |= mask >> 8; mask |= mask >> 16; mask |= mask >> 32;
+        
+        uint64_t target;
+        do {
+            target = rng.next_uint64() & mask;
+        } while (target >= total_weight);
+        return find(target);
+    }
+};
+
+// Weighted sampling without replacement (Efraimidis & Spirakis). Item i
+// gets the key log(u) / w; the k largest keys, in descending order, are a
+// weighted draw of k distinct items in pick order.
+namespace RandomixSampling {
+    // (0, 1) with 53 bits, never 0 so it is safe under log
+    template <typename Engine>
+    double open_unit(Engine& rng) {
+        return (static_cast<double>(rng.next_uint64() >> 11) + 0.5) / 9007199254740992.0;
+    }
+    
+    struct Keyed {
+        double key;
+        uint32_t index;
+        
+        // Heap/sort order: larger keys first, lower index on a tie
+        bool operator<(const Keyed& other) const {
+            return key != other.key ? key > other.key : index < other.index;
+        }
+    };
+    
+    // A-ExpJ: after the reservoir fills, whole runs of items are skipped
+    // with one draw, so only O(k log(n / k)) keys are generated. Writes up
+    // to k indices in pick order and returns how many (the number of
+    // positive weights, if smaller than k).
+    template <typename Engine>
+    size_t weighted_sample(Engine& rng, const int32_t* weights, size_t count, size_t k, uint32_t* out) {
+        // k past the item count means "all"; never size the heap from it
+        k = std::min(k, count);
+        if (k == 0) return 0;
+        
+        // Keyed::operator< inverts the key, so the heap top is the smallest key
+        std::vector<Keyed> heap;
+        heap.reserve(k);
+        
+        size_t i = 0;
+        for (; i < count && heap.size() < k; ++i) {
+            if (weights[i] <= 0) continue;
+            heap.push_back({ std::log(open_unit(rng)) / static_cast<double>(weights[i]), static_cast<uint32_t>(i) });
+            std::push_heap(heap.begin(), heap.end());
+        }
+        
+        if (heap.size() == k) {
+            double threshold = heap.front().key;
+            double skip = std::log(open_unit(rng)) / threshold;
+            
+            for (; i < count; ++i) {
+                if (weights[i] <= 0) continue;
+                double w = static_cast<double>(weights[i]);
+                skip -= w;
+                if (skip > 0.0) continue;
+                
+                // This item enters: its key is drawn above the threshold
+                double floor = std::exp(threshold * w);
+                double u = floor + (1.0 - floor) * open_unit(rng);
+                
+                std::pop_heap(heap.begin(), heap.end());
+                heap.back() = { std::log(u) / w, static_cast<uint32_t>(i) };
+                std::push_heap(heap.begin(), heap.end());
+                
+                threshold = heap.front().key;
+                skip = std::log(open_unit(rng)) / threshold;
+            }
+        }
+        
+        std::sort(heap.begin(), heap.end());
+        for (size_t j = 0; j < heap.size(); ++j) {
+            out[j] = heap[j].index;
+        }
+        return heap.size();
+    }
+    
+    // k distinct values from [0, n) by Floyd's algorithm: O(k) time and
+    // memory however large n is. Membership uses a bitmap while n is within
+    // 64k bits (still O(k) words), a hash set beyond that. The result is
+    // then shuffled or sorted; Floyd's own order is not uniform.
+    template <typename Engine>
+    void uniform_sample(Engine& rng, uint32_t n, uint32_t k, uint32_t* out, bool sorted) {
+        k = std::min(k, n);
+        if (k == 0) return;
+        
+        size_t filled = 0;
+        if (static_cast<uint64_t>(n) <= static_cast<uint64_t>(k) * 64) {
+            std::vector<uint64_t> seen((static_cast<size_t>(n) + 63) / 64, 0);
+            for (uint32_t j = n - k; j < n; ++j) {
+                uint32_t t = rng.next_bounded(j + 1);
+                if (seen[t >> 6] & (1ULL << (t & 63))) t = j;
+                seen[t >> 6] |= 1ULL << (t & 63);
+                out[filled++] = t;
+            }
+        } else {
+            std::unordered_set<uint32_t> seen;
+            seen.reserve(k);
+            for (uint32_t j = n - k; j < n; ++j) {
+                uint32_t t = rng.next_bounded(j + 1);
+                if (!seen.insert(t).second) {
+                    t = j;
+                    seen.insert(t);
+                }
+                out[filled++] = t;
+            }
+        }
+        
+        if (sorted) {
+            std::sort(out, out + k);
+            return;
+        }
+        
+        for (uint32_t i = k - 1; i > 0; --i) {
+            std::swap(out[i], out[rng.next_bounded(i + 1)]);
+        }
+    }
+    
+    // Permutation of [0, count) in weighted pick order. Items with weight
+    // <= 0 come last, uniformly shuffled among themselves.
+    template <typename Engine>
+    void weighted_order(Engine& rng, const int32_t* weights, size_t count, uint32_t* out) {
+        std::vector<Keyed> keys(count);
+        for (size_t i = 0; i < count; ++i) {
+            double key = std::log(open_unit(rng));
+            // Zero weights sit below every positive key (those are > -38)
+            key = weights[i] > 0 ? key / static_cast<double>(weights[i]) : key - 1e6;
+            keys[i] = { key, static_cast<uint32_t>(i) };
+        }
+        
+        std::sort(keys.begin(), keys.end());
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = keys[i].index;
+        }
+    }
+}
+
+// Card shoe dealt by lazy Fisher-Yates: each draw swaps one random
+// remaining card into the dealt prefix, so a round only pays for the cards
+// it deals and a reshuffle just returns every card (any order of the
+// undealt cards is as good as a fresh shuffle). Card i has value
+// i % deck_size, so multi-deck shoes repeat the values.
+class Deck {
+public:
+    enum class Source {
+        PRNG = 0,   // The script's PRand* engine
+        CSPRNG = 1  // ChaCha, for real-money style games
+    };
+    
+    // Largest shoe the natives will create
+    static constexpr size_t MAX_CARDS = 1 << 20;
+    
+private:
+    std::vector<uint32_t> cards;
+    uint32_t deck_size;
+    size_t dealt = 0;
+    size_t cut_min = 0, cut_max = 0;  // 0 = no cut card
+    size_t cut = 0;
+    int auto_threshold = -1;           // -1 = never reshuffle on draw
+    
+public:
+    Source source;
+    
+    Deck(uint32_t deck_size, uint32_t decks, Source source);
+    
+    size_t size() const { return cards.size(); }
+    size_t remaining() const { return cards.size() - dealt; }
+    bool cut_reached() const { return cut > 0 && dealt >= cut; }
+    
+    void set_auto_shuffle(int threshold) { auto_threshold = threshold; }
+    
+    // Cut card lands uniformly in [min, max] dealt cards, placed now and
+    // again after each shuffle; max = 0 removes it
+    template <typename Engine>
+    void set_cut(Engine& rng, size_t min, size_t max) {
+        cut_max = std::min(std::max(min, max), cards.size());
+        cut_min = std::min(std::min(min, max), cut_max);
+        place_cut(rng);
+    }
+    
+    template <typename Engine>
+    void place_cut(Engine& rng) {
+        cut = cut_max == 0 ? 0 : cut_min + rng.next_bounded(static_cast<uint32_t>(cut_max - cut_min + 1));
+    }
+    
+    template <typename Engine>
+    void shuffle(Engine& rng) {
+        dealt = 0;
+        place_cut(rng);
+    }
+    
+    // Card value, or -1 when the shoe is empty
+    template <typename Engine>
+    int draw(Engine& rng) {
+        if (auto_threshold >= 0 && remaining() <= static_cast<size_t>(auto_threshold)) shuffle(rng);
+        if (remaining() == 0) return -1;
+        
+        size_t j = dealt + rng.next_bounded(static_cast<uint32_t>(remaining()));
+        std::swap(cards[dealt], cards[j]);
+        return static_cast<int>(cards[dealt++] % deck_size);
+    }
+};
+
+// Keyed bijection on [0, n) with no storage: a balanced Feistel network
+// over the smallest even bit width covering n, cycle-walked back into range
+// (under 4 rounds of walking on average). Not a cipher; the key only has to
+// be secret for the order to be unpredictable.
+class FeistelPermutation {
+public:
+    static constexpr int ROUNDS = 6;
+    
+private:
+    uint32_t n;
+    int half_bits;
+    uint32_t half_mask;
+    uint64_t keys[ROUNDS];
+    
+    uint32_t round(uint32_t half, uint64_t key) const;
+    uint32_t encrypt(uint32_t x) const;
+    uint32_t decrypt(uint32_t x) const;
+    
+public:
+    // n in [1, 2^31]; round keys come from the engine
+    template <typename Engine>
+    FeistelPermutation(uint32_t n, Engine& rng) : n(n) {
+        int bits = 2;
+        while (bits < 32 && (1ULL << bits) < n) ++bits;
+        half_bits = (bits + 1) / 2;
+        half_mask = (1u << half_bits) - 1;
+        
+        // Two 32-bit words per key, which every engine (ChaCha too) provides
+        for (uint64_t& key : keys) {
+            uint64_t hi = rng.next_uint32();
+            key = (hi << 32) | rng.next_uint32();
+        }
+    }
+    
+    uint32_t size() const { return n; }
+    // Value at position index; index must be below size()
+    uint32_t forward(uint32_t index) const;
+    // Position of value; value must be below size()
+    uint32_t inverse(uint32_t value) const;
+};
+
+// Dice rolling. Several rolls come out of each 32-bit draw by batched
+// multiply extraction (Brackett-Rozinsky & Lemire): multiplying the word
+// by `sides` yields a roll in the high half and leaves the low half for the
+// next roll. One leftover check per word keeps every batch exact and
+// unbiased; that is 11 d6 or 7 d20 per draw.
+namespace RandomixDice {
+    // Rolls per word and sides^digits. A word is rejected with probability
+    // (2^32 mod sides^digits) / 2^32, which nears 1/2 when the power is just
+    // past 2^31 (6^12), so pick the digits with the most accepted rolls per word
+    inline void packing(uint32_t sides, uint32_t& digits, uint32_t& bound) {
+        digits = 0;
+        bound = 1;
+        
+        double best = 0.0;
+        uint64_t b = 1;
+        for (uint32_t n = 1; sides > 1 && b * sides <= UINT32_MAX; ++n) {
+            b *= sides;
+            double reject = static_cast<double>((0u - static_cast<uint32_t>(b)) % static_cast<uint32_t>(b)) / 4294967296.0;
+            double yield = n * (1.0 - reject);
+            if (yield > best) {
+                best = yield;
+                digits = n;
+                bound = static_cast<uint32_t>(b);
+            }
+        }
+    }
+    
+    // Calls fn(face) for count rolls, face in [0, sides)
+    template <typename Engine, typename F>
+    void for_each_roll(Engine& rng, uint32_t sides, uint32_t digits, uint32_t bound, uint64_t count, F&& fn) {
+        if (sides <= 1) {
+            for (uint64_t i = 0; i < count; ++i) fn(0u);
+            return;
+        }
+        
+        uint32_t faces[32];
+        uint32_t threshold = (0u - bound) % bound;
+        
+        while (count > 0) {
+            uint32_t n = digits;
+            uint32_t b = bound;
+            uint32_t t = threshold;
+            if (count < n) {
+                n = static_cast<uint32_t>(count);
+                b = 1;
+                for (uint32_t i = 0; i < n; ++i) b *= sides;
+                t = (0u - b) % b;
+            }
+            
+            uint32_t leftover;
+            do {
+                leftover = rng.next_uint32();
+                for (uint32_t i = 0; i < n; ++i) {
+                    uint64_t m = static_cast<uint64_t>(leftover) * sides;
+                    faces[i] = static_cast<uint32_t>(m >> 32);
+                    leftover = static_cast<uint32_t>(m);
+                }
+            } while (leftover < t);
+            
+            for (uint32_t i = 0; i < n; ++i) fn(faces[i]);
+            count -= n;
+        }
+    }
+    
+    // Sum of count dice with faces 1..sides
+    template <typename Engine>
+    uint64_t sum(Engine& rng, uint32_t sides, uint64_t count) {
+        if (sides <= 1) return sides == 1 ? count : 0;
+        
+        uint32_t digits, bound;
+        packing(sides, digits, bound);
+        uint32_t threshold = (0u - bound) % bound;
+        
+        uint64_t total = count;
+        for (; count >= digits; count -= digits) {
+            uint32_t leftover, batch;
+            do {
+                leftover = rng.next_uint32();
+                batch = 0;
+                for (uint32_t i = 0; i < digits; ++i) {
+                    uint64_t m = static_cast<uint64_t>(leftover) * sides;
+                    batch += static_cast<uint32_t>(m >> 32);
+                    leftover = static_cast<uint32_t>(m);
+                }
+            } while (leftover < threshold);
+            total += batch;
+        }
+        
+        for_each_roll(rng, sides, digits, bound, count, [&](uint32_t face) { total += face; });
+        return total;
+    }
+}
+
+// Compiled dice expression such as "4d6kh3", "2d20k + 5" or "3d6! - 2".
+// Terms are summed; each is a constant or NdS with optional modifiers:
+// kh/k N keep highest, kl N keep lowest, dl/d N drop lowest, dh N drop
+// highest, ! exploding (reroll and add on a max face). "d%" is d100.
+class DiceExpression {
+public:
+    static constexpr uint32_t MAX_DICE = 1000000;
+    static constexpr uint32_t MAX_SIDES = 1000000;
+    static constexpr size_t MAX_TERMS = 32;
+    static constexpr int MAX_EXPLOSIONS = 100;
+    // Keep/drop on dice up to this many sides counts faces instead of sorting
+    static constexpr uint32_t HISTOGRAM_SIDES = 1024;
+    
+    struct Term {
+        int32_t sign = 1;
+        int32_t constant = 0;
+        uint32_t count = 0;     // 0 for a constant term
+        uint32_t sides = 0;
+        uint32_t keep = 0;      // dice kept, == count without keep/drop
+        bool keep_high = true;
+        bool explode = false;
+        uint32_t digits = 0;    // RandomixDice::packing for sides
+        uint32_t bound = 0;
+    };
+    
+private:
+    std::vector<Term> terms;
+    
+    template <typename Engine>
+    int64_t roll_term(Engine& rng, const Term& t) const {
+        if (t.count == 0) return t.constant;
+        
+        if (!t.explode && t.keep == t.count) {
+            return static_cast<int64_t>(RandomixDice::sum(rng, t.sides, t.count));
+        }
+        
+        if (!t.explode && t.sides <= HISTOGRAM_SIDES) {
+            std::vector<uint32_t> faces(t.sides, 0);
+            RandomixDice::for_each_roll(rng, t.sides, t.digits, t.bound, t.count,
+                [&](uint32_t face) { ++faces[face]; });
+            
+            int64_t total = 0;
+            uint32_t left = t.keep;
+            for (uint32_t i = 0; i < t.sides && left > 0; ++i) {
+                uint32_t face = t.keep_high ? t.sides - 1 - i : i;
+                uint32_t take = std::min(left, faces[face]);
+                total += static_cast<int64_t>(take) * (face + 1);
+                left -= take;
+            }
+            return total;
+        }
+        
+        std::vector<int64_t> dice(t.count);
+        for (uint32_t i = 0; i < t.count; ++i) {
+            uint32_t face = rng.next_bounded(t.sides) + 1;
+            int64_t value = face;
+            for (int n = 0; t.explode && face == t.sides && n < MAX_EXPLOSIONS; ++n) {
+                face = rng.next_bounded(t.sides) + 1;
+                value += face;
+            }
+            dice[i] = value;
+        }
+        
+        if (t.keep < t.count) {
+            if (t.keep_high) {
+                std::nth_element(dice.begin(), dice.begin() + t.keep, dice.end(), std::greater<int64_t>());
+            } else {
+                std::nth_element(dice.begin(), dice.begin() + t.keep, dice.end());
+            }
+        }
+        
+        int64_t total = 0;
+        for (uint32_t i = 0; i < t.keep; ++i) total += dice[i];
+        return total;
+    }
+    
+public:
+    // Replaces the expression; false on a syntax error or out-of-range value
+    bool parse(const char* text);
+    
+    // Result saturated to the int32 range
+    template <typename Engine>
+    int32_t roll(Engine& rng) const {
+        int64_t total = 0;
+        for (const Term& t : terms) {
+            total += t.sign * roll_term(rng, t);
+        }
+        return static_cast<int32_t>(std::min<int64_t>(std::max<int64_t>(total, INT32_MIN), INT32_MAX));
+    }
+};
+
+// Static 2D zone: the outline and any holes are ear-clipped once (holes are
+// bridged into the outline first), then a triangle is picked through an
+// alias table over the areas, so each sample is O(1) with no allocation.
+// Handles concave outlines; self-intersecting rings are rejected.
+class Polygon {
+public:
+    // Largest vertex count over all rings the natives will accept
+    static constexpr size_t MAX_VERTICES = 1024;
+    
+private:
+    struct Triangle {
+        float x, y;      // first corner
+        float ux, uy;    // edge to the second corner
+        float vx, vy;    // edge to the third corner
+    };
+    
+    std::vector<std::vector<float>> rings;  // flat x,y pairs; [0] is the outline
+    size_t vertex_count = 0;
+    std::vector<Triangle> triangles;
+    AliasTable picker;
+    double total_area = 0.0;
+    float min_x = 0.0f, min_y = 0.0f, max_x = 0.0f, max_y = 0.0f;
+    
+    bool triangulate();
+    
+public:
+    // Both fail and leave the polygon unchanged if the ring is degenerate,
+    // too large or does not triangulate (e.g. a hole crossing the outline)
+    bool set_outline(const float* xy, size_t count);
+    bool add_hole(const float* xy, size_t count);
+    
+    double area() const { return total_area; }
+    
+    void bounds(float& x0, float& y0, float& x1, float& y1) const {
+        x0 = min_x; y0 = min_y; x1 = max_x; y1 = max_y;
+    }
+    
+    // Inside the outline and outside every hole (even-odd over all rings)
+    bool contains(float x, float y) const;
+    
+    // PRandPointInPolygon's original fan from vertex 0, for outlines
+    // set_outline rejects (too many vertices, crossing edges): O(n), exact
+    // for convex outlines only. False if the fan has no area.
+    template <typename Engine>
+    static bool sample_fan(Engine& rng, const float* xy, size_t count, float& x, float& y) {
+        auto fan_area = [&](size_t i) {
+            float ux = xy[i * 2] - xy[0], uy = xy[i * 2 + 1] - xy[1];
+            float vx = xy[i * 2 + 2] - xy[0], vy = xy[i * 2 + 3] - xy[1];
+            return std::fabs(ux * vy - vx * uy) * 0.5f;
+        };
+        
+        float total = 0.0f;
+        for (size_t i = 1; i + 1 < count; ++i) total += fan_area(i);
+        if (!(total > 0.0f)) return false;
+        
+        float target = rng.next_float() * total;
+        size_t chosen = 1;
+        for (float sum = 0.0f; chosen + 2 < count; ++chosen) {
+            sum += fan_area(chosen);
+            if (target < sum) break;
+        }
+        
+        float r1 = rng.next_float();
+        float r2 = rng.next_float();
+        if (r1 + r2 > 1.0f) {
+            r1 = 1.0f - r1;
+            r2 = 1.0f - r2;
+        }
+        
+        float ux = xy[chosen * 2] - xy[0], uy = xy[chosen * 2 + 1] - xy[1];
+        float vx = xy[chosen * 2 + 2] - xy[0], vy = xy[chosen * 2 + 3] - xy[1];
+        x = xy[0] + r1 * ux + r2 * vx;
+        y = xy[1] + r1 * uy + r2 * vy;
+        return true;
+    }
+    
+    // Caller checks area() > 0
+    template <typename Engine>
+    void sample(Engine& rng, float& x, float& y) const {
+        const Triangle& t = triangles[picker.pick(rng)];
+        float r1 = rng.next_float();
+        float r2 = rng.next_float();
+        
+        if (r1 + r2 > 1.0f) {
+            r1 = 1.0f - r1;
+            r2 = 1.0f - r2;
+        }
+        
+        x = t.x + r1 * t.ux + r2 * t.vx;
+        y = t.y + r1 * t.uy + r2 * t.vy;
+    }
+};
+
+// Paths and road networks sampled by arc length: each segment keeps its
+// start, direction and the cumulative length at its end, so a uniform point
+// is an alias pick plus a lerp (O(1)) and the point at a given distance is a
+// binary search (O(log n)). Several paths can share one handle.
+class Polyline {
+public:
+    // Largest total point count the natives will accept
+    static constexpr size_t MAX_POINTS = 1 << 20;
+    
+private:
+    struct Segment {
+        float x, y, z;     // start
+        float dx, dy, dz;  // start to end
+        float nx, ny;      // unit horizontal normal, for lateral jitter
+    };
+    
+    int dims;
+    size_t point_count = 0;
+    std::vector<Segment> segments;
+    std::vector<double> cumulative;
+    AliasTable picker;
+    
+public:
+    // dimensions is 2 (x,y pairs, z = 0) or 3 (x,y,z triples)
+    explicit Polyline(int dimensions) : dims(dimensions) {}
+    
+    int dimensions() const { return dims; }
+    double length() const { return cumulative.empty() ? 0.0 : cumulative.back(); }
+    
+    // Adds a path, a separate road when the line already holds some;
+    // zero-length segments are skipped. Fails, leaving the line unchanged,
+    // if the path adds no length or the line would exceed MAX_POINTS.
+    bool append(const float* points, size_t count, bool closed);
+    
+    // Point at distance along the paths in the order they were added,
+    // clamped to [0, length()]; caller checks length() > 0
+    void at(double distance, float& x, float& y, float& z) const;
+    
+    // Uniform by arc length, pushed sideways by up to jitter (horizontally);
+    // caller checks length() > 0
+    template <typename Engine>
+    void sample(Engine& rng, float jitter, float& x, float& y, float& z) const {
+        const Segment& s = segments[picker.pick(rng)];
+        float t = rng.next_float();
+        x = s.x + t * s.dx;
+        y = s.y + t * s.dy;
+        z = s.z + t * s.dz;
+        
+        if (jitter > 0.0f) {
+            float offset = (rng.next_float() * 2.0f - 1.0f) * jitter;
+            x += offset * s.nx;
+            y += offset * s.ny;
+        }
+    }
+};
+
+// Primitives for ZoneSet. Each gives its volume, a bounding sphere, a
+// containment test and a uniform sample; angles are in degrees, vertical is Z.
+namespace RandomixZones {
+    struct Bounds {
+        float x, y, z, radius;
+    };
+    
+    // Uniform point in the unit ball, by rejection from the cube (52% hit)
+    template <typename Engine>
+    void unit_ball(Engine& rng, float& x, float& y, float& z) {
+        do {
+            x = rng.next_float() * 2.0f - 1.0f;
+            y = rng.next_float() * 2.0f - 1.0f;
+            z = rng.next_float() * 2.0f - 1.0f;
+        } while (x * x + y * y + z * z > 1.0f);
+    }
+    
+    struct Box {
+        float min_x, min_y, min_z, max_x, max_y, max_z;
+        
+        double volume() const {
+            return static_cast<double>(max_x - min_x) * (max_y - min_y) * (max_z - min_z);
+        }
+        
+        Bounds bounds() const {
+            float hx = (max_x - min_x) * 0.5f, hy = (max_y - min_y) * 0.5f, hz = (max_z - min_z) * 0.5f;
+            return { min_x + hx, min_y + hy, min_z + hz, std::sqrt(hx * hx + hy * hy + hz * hz) };
+        }
+        
+        bool contains(float x, float y, float z) const {
+            return x >= min_x && x <= max_x && y >= min_y && y <= max_y && z >= min_z && z <= max_z;
+        }
+        
+        template <typename Engine>
+        void sample(Engine& rng, float& x, float& y, float& z) const {
+            x = min_x + rng.next_float() * (max_x - min_x);
+            y = min_y + rng.next_float() * (max_y - min_y);
+            z = min_z + rng.next_float() * (max_z - min_z);
+        }
+    };
+    
+    // Box rotated about Z around its centre
+    struct OrientedBox {
+        float x, y, z;
+        float half_x, half_y, half_z;
+        float cos_z, sin_z;
+        
+        double volume() const {
+            return 8.0 * half_x * half_y * half_z;
+        }
+        
+        Bounds bounds() const {
+            return { x, y, z, std::sqrt(half_x * half_x + half_y * half_y + half_z * half_z) };
+        }
+        
+        bool contains(float px, float py, float pz) const {
+            float dx = px - x, dy = py - y;
+            float lx = dx * cos_z + dy * sin_z;
+            float ly = dy * cos_z - dx * sin_z;
+            return std::fabs(lx) <= half_x && std::fabs(ly) <= half_y && std::fabs(pz - z) <= half_z;
+        }
+        
+        template <typename Engine>
+        void sample(Engine& rng, float& px, float& py, float& pz) const {
+            float lx = (rng.next_float() * 2.0f - 1.0f) * half_x;
+            float ly = (rng.next_float() * 2.0f - 1.0f) * half_y;
+            pz = z + (rng.next_float() * 2.0f - 1.0f) * half_z;
+            px = x + lx * cos_z - ly * sin_z;
+            py = y + lx * sin_z + ly * cos_z;
+        }
+    };
+    
+    struct Sphere {
+        float x, y, z, radius;
+        
+        double volume() const {
+            return 4.18879020479 * radius * radius * radius;
+        }
+        
+        Bounds bounds() const {
+            return { x, y, z, radius };
+        }
+        
+        bool contains(float px, float py, float pz) const {
+            float dx = px - x, dy = py - y, dz = pz - z;
+            return dx * dx + dy * dy + dz * dz <= radius * radius;
+        }
+        
+        template <typename Engine>
+        void sample(Engine& rng, float& px, float& py, float& pz) const {
+            unit_ball(rng, px, py, pz);
+            px = x + px * radius;
+            py = y + py * radius;
+            pz = z + pz * radius;
+        }
+    };
+    
+    // Upright cylinder standing on its base centre
+    struct Cylinder {
+        float x, y, z, radius, height;
+        
+        double volume() const {
+            return 3.14159265359 * radius * radius * height;
+        }
+        
+        Bounds bounds() const {
+            float half = height * 0.5f;
+            return { x, y, z + half, std::sqrt(radius * radius + half * half) };
+        }
+        
+        bool contains(float px, float py, float pz) const {
+            float dx = px - x, dy = py - y;
+            return pz >= z && pz <= z + height && dx * dx + dy * dy <= radius * radius;
+        }
+        
+        template <typename Engine>
+        void sample(Engine& rng, float& px, float& py, float& pz) const {
+            float angle = rng.next_float() * 6.28318530718f;
+            float r = radius * std::sqrt(rng.next_float());
+            px = x + r * std::cos(angle);
+            py = y + r * std::sin(angle);
+            pz = z + rng.next_float() * height;
+        }
+    };
+    
+    // Points within radius of the segment from (x, y, z) along (ax, ay, az):
+    // a cylinder body with a hemisphere on each end
+    struct Capsule {
+        float x, y, z;
+        float ax, ay, az;
+        float radius, length;
+        float ux, uy, uz, vx, vy, vz;  // unit basis across the axis
+        
+        Capsule(float x1, float y1, float z1, float x2, float y2, float z2, float radius);
+        
+        double body_volume() const {
+            return 3.14159265359 * radius * radius * length;
+        }
+        
+        double volume() const {
+            return body_volume() + 4.18879020479 * radius * radius * radius;
+        }
+        
+        Bounds bounds() const {
+            return { x + ax * 0.5f, y + ay * 0.5f, z + az * 0.5f, length * 0.5f + radius };
+        }
+        
+        bool contains(float px, float py, float pz) const {
+            float dx = px - x, dy = py - y, dz = pz - z;
+            float t = length > 0.0f ? (dx * ax + dy * ay + dz * az) / (length * length) : 0.0f;
+            t = std::min(std::max(t, 0.0f), 1.0f);
+            dx -= t * ax; dy -= t * ay; dz -= t * az;
+            return dx * dx + dy * dy + dz * dz <= radius * radius;
+        }
+        
+        template <typename Engine>
+        void sample(Engine& rng, float& px, float& py, float& pz) const {
+            if (rng.next_float() * volume() < body_volume()) {
+                float t = rng.next_float();
+                float angle = rng.next_float() * 6.28318530718f;
+                float r = radius * std::sqrt(rng.next_float());
+                float c = r * std::cos(angle), s = r * std::sin(angle);
+                px = x + t * ax + c * ux + s * vx;
+                py = y + t * ay + c * uy + s * vy;
+                pz = z + t * az + c * uz + s * vz;
+                return;
+            }
+            
+            // The two end caps make one ball; each half goes on its own end
+            float bx, by, bz;
+            unit_ball(rng, bx, by, bz);
+            float t = bx * ax + by * ay + bz * az >= 0.0f ? 1.0f : 0.0f;
+            px = x + t * ax + bx * radius;
+            py = y + t * ay + by * radius;
+            pz = z + t * az + bz * radius;
+        }
+    };
+    
+    using Zone = std::variant<Box, OrientedBox, Sphere, Cylinder, Capsule>;
+}
+
+// Event area built from mixed primitives, sampled uniformly over their
+// union: a primitive is picked by volume through an alias table (O(1)) and
+// a point inside it is kept with probability 1 / (primitives covering it),
+// so overlaps aren't sampled twice as often. Only primitives whose bounding
+// spheres meet are checked, so a set of disjoint zones never rejects.
+class ZoneSet {
+public:
+    // Largest number of primitives per set
+    static constexpr size_t MAX_ZONES = 1024;
+    
+private:
+    std::vector<RandomixZones::Zone> zones;
+    std::vector<RandomixZones::Bounds> bounds;
+    std::vector<std::vector<uint32_t>> overlaps;
+    AliasTable picker;
+    
+public:
+    // Fails if the primitive has no volume or the set is full
+    bool add(const RandomixZones::Zone& zone);
+    
+    size_t size() const { return zones.size(); }
+    
+    bool contains(float x, float y, float z) const;
+    
+    // Caller checks size() > 0
+    template <typename Engine>
+    void sample(Engine& rng, float& x, float& y, float& z) const {
+        for (;;) {
+            uint32_t index = picker.pick(rng);
+            std::visit([&](const auto& zone) { zone.sample(rng, x, y, z); }, zones[index]);
+            if (overlaps[index].empty()) return;
+            
+            uint32_t covering = 1;
+            for (uint32_t other : overlaps[index]) {
+                if (std::visit([&](const auto& zone) { return zone.contains(x, y, z); }, zones[other])) ++covering;
+            }
+            if (covering == 1 || rng.next_bounded(covering) == 0) return;
+        }
+    }
+};
+
+// Blue-noise point sets (Bridson): points at least min_dist apart, grown
+// from active points with CANDIDATES tries each in the [r, 2r] annulus. A
+// background grid of r/sqrt(2) cells holds at most one point per cell, so a
+// candidate checks a 5x5 block and the whole set costs O(points).
+// A Region provides bounds(), contains() and a uniform sample().
+namespace RandomixPoisson {
+    constexpr int CANDIDATES = 30;
+    // Rotation by the golden angle, so any run of candidates spreads evenly
+    constexpr float STEP_COS = -0.73736887808f;
+    constexpr float STEP_SIN = 0.67549029426f;
+    
+    // Largest background grid (one int32 per cell) the natives will allocate
+    constexpr size_t MAX_CELLS = 1 << 22;
+    
+    struct Rect {
+        float min_x, min_y, max_x, max_y;
+        
+        void bounds(float& x0, float& y0, float& x1, float& y1) const {
+            x0 = min_x; y0 = min_y; x1 = max_x; y1 = max_y;
+        }
+        
+        bool contains(float x, float y) const {
+            return x >= min_x && x <= max_x && y >= min_y && y <= max_y;
+        }
+        
+        template <typename Engine>
+        void sample(Engine& rng, float& x, float& y) const {
+            x = min_x + rng.next_float() * (max_x - min_x);
+            y = min_y + rng.next_float() * (max_y - min_y);
+        }
+    };
+    
+    struct Disc {
+        float center_x, center_y, radius;
+        
+        void bounds(float& x0, float& y0, float& x1, float& y1) const {
+            x0 = center_x - radius; y0 = center_y - radius;
+            x1 = center_x + radius; y1 = center_y + radius;
+        }
+        
+        bool contains(float x, float y) const {
+            float dx = x - center_x;
+            float dy = y - center_y;
+            return dx * dx + dy * dy <= radius * radius;
+        }
+        
+        template <typename Engine>
+        void sample(Engine& rng, float& x, float& y) const {
+            float angle = rng.next_float() * 6.28318530718f;
+            float r = radius * std::sqrt(rng.next_float());
+            x = center_x + r * std::cos(angle);
+            y = center_y + r * std::sin(angle);
+        }
+    };
+    
+    // Writes up to max_points points and returns how many fit; 0 if the
+    // grid for this region and distance would exceed MAX_CELLS
+    template <typename Engine, typename Region>
+    size_t fill(Engine& rng, const Region& region, float min_dist, float* xs, float* ys, size_t max_points) {
+        float min_x, min_y, max_x, max_y;
+        region.bounds(min_x, min_y, max_x, max_y);
+        if (!(min_dist > 0.0f) || !(max_x >= min_x) || !(max_y >= min_y)) return 0;
+        
+        double cell = min_dist / std::sqrt(2.0);
+        double columns = std::floor((static_cast<double>(max_x) - min_x) / cell) + 1.0;
+        double rows = std::floor((static_cast<double>(max_y) - min_y) / cell) + 1.0;
+        if (columns * rows > static_cast<double>(MAX_CELLS)) return 0;
+        
+        size_t width = static_cast<size_t>(columns);
+        size_t height = static_cast<size_t>(rows);
+        std::vector<int32_t> grid(width * height, -1);
+        std::vector<uint32_t> active;
+        float min_dist2 = min_dist * min_dist;
+        size_t count = 0;
+        
+        auto cell_of = [&](float x, float y) {
+            double cx = std::floor((static_cast<double>(x) - min_x) / cell);
+            double cy = std::floor((static_cast<double>(y) - min_y) / cell);
+            size_t column = static_cast<size_t>(std::min(std::max(cx, 0.0), columns - 1.0));
+            size_t row = static_cast<size_t>(std::min(std::max(cy, 0.0), rows - 1.0));
+            return std::make_pair(column, row);
+        };
+        
+        // Spacing first: it is O(1), while containment in a polygon is
+        // O(vertices) and most candidates fail on spacing
+        auto fits = [&](float x, float y) {
+            // A cell holds at most one point, so an occupied cell rejects
+            // outright (the common miss once the front fills in)
+            auto at = cell_of(x, y);
+            if (grid[at.second * width + at.first] >= 0) return false;
+            
+            size_t column0 = at.first > 2 ? at.first - 2 : 0;
+            size_t row0 = at.second > 2 ? at.second - 2 : 0;
+            size_t column1 = std::min(at.first + 2, width - 1);
+            size_t row1 = std::min(at.second + 2, height - 1);
+            
+            for (size_t row = row0; row <= row1; ++row) {
+                for (size_t column = column0; column <= column1; ++column) {
+                    int32_t other = grid[row * width + column];
+                    if (other < 0) continue;
+                    
+                    float dx = xs[other] - x;
+                    float dy = ys[other] - y;
+                    if (dx * dx + dy * dy < min_dist2) return false;
+                }
+            }
+            return region.contains(x, y);
+        };
+        
+        auto place = [&](float x, float y) {
+            auto at = cell_of(x, y);
+            xs[count] = x;
+            ys[count] = y;
+            grid[at.second * width + at.first] = static_cast<int32_t>(count);
+            active.push_back(static_cast<uint32_t>(count));
+            ++count;
+        };
+        
+        while (count < max_points) {
+            // (Re)seed from a uniform point, so parts the front can't reach
+            // (past a narrow neck) still fill; repeated misses mean it's full
+            if (active.empty()) {
+                bool seeded = false;
+                for (int i = 0; i < CANDIDATES && !seeded; ++i) {
+                    float x, y;
+                    region.sample(rng, x, y);
+                    if (fits(x, y)) {
+                        place(x, y);
+                        seeded = true;
+                    }
+                }
+                if (!seeded) break;
+                continue;
+            }
+            
+            size_t slot = rng.next_bounded(static_cast<uint32_t>(active.size()));
+            uint32_t from = active[slot];
+            bool found = false;
+            
+            // Candidates walk round the point from a random start angle (one
+            // sincos per active point), each at an area-uniform radius in [r, 2r]
+            float angle = rng.next_float() * 6.28318530718f;
+            float dir_x = std::cos(angle);
+            float dir_y = std::sin(angle);
+            
+            for (int i = 0; i < CANDIDATES; ++i) {
+                float r = min_dist * std::sqrt(1.0f + 3.0f * rng.next_float());
+                float x = xs[from] + r * dir_x;
+                float y = ys[from] + r * dir_y;
+                
+                float next_x = dir_x * STEP_COS - dir_y * STEP_SIN;
+                dir_y = dir_x * STEP_SIN + dir_y * STEP_COS;
+                dir_x = next_x;
+                
+                if (fits(x, y)) {
+                    place(x, y);
+                    found = true;
+                    break;
+                }
+            }
+            
+            if (!found) {
+                active[slot] = active.back();
+                active.pop_back();
+            }
+        }
+        return count;
+    }
+}
+
+// Per-script store for native objects handed to Pawn as integer handles.
+// Handles start at 1 so 0 can mean "invalid"; freed slots are reused.
+template <typename T>
+class HandlePool {
+private:
+    std::vector<std::unique_ptr<T>> slots;
+    std::vector<int> free_slots;
+    
+public:
+    int add(std::unique_ptr<T> object) {
+        if (!free_slots.empty()) {
+            int slot = free_slots.back();
+            free_slots.pop_back();
+            slots[slot] = std::move(object);
+            return slot + 1;
+        }
+        slots.push_back(std::move(object));
+        return static_cast<int>(slots.size());
+    }
+    
+    T* get(int handle) const {
+        if (handle <= 0 || handle > static_cast<int>(slots.size())) return nullptr;
+        return slots[handle - 1].get();
+    }
+    
+    bool remove(int handle) {
+        if (!get(handle)) return false;
+        slots[handle - 1].reset();
+        free_slots.push_back(handle - 1);
+        return true;
+    }
 };
 
 // ChaChaRNG - Cryptographic Random
-class ChaChaRNG {
+// ROUNDS selects ChaCha20 (default), ChaCha12 or ChaCha8
+template <int ROUNDS>
+class BasicChaChaRNG {
 private:
-    static constexpr int ROUNDS = 20;
+    static_assert(ROUNDS == 8 || ROUNDS == 12 || ROUNDS == 20, "ChaCha supports 8, 12 or 20 rounds");
+    
+    // Keystream is produced 16 blocks at a time so the SIMD kernels stay busy
+    static constexpr int BUFFER_BLOCKS = 16;
+    static constexpr int BUFFER_WORDS = 16 * BUFFER_BLOCKS;
     std::array<uint32_t, 16> state;
-    uint32_t block[16];
+    alignas(64) uint32_t block[BUFFER_WORDS];
     int position;
     uint64_t counter;
     uint64_t bytes_generated;
     static constexpr uint64_t RESEED_THRESHOLD = 32 * 1024 * 1024;
+    // Largest run written straight into a caller buffer between reseed checks
+    static constexpr size_t DIRECT_BATCH_BLOCKS = 1024;
     
     static constexpr uint32_t CONSTANTS[4] = {
         0x61707865, 0x3320646e, 0x79622d32, 0x6b206574
@@ -40,17 +1448,64 @@ private:
     void quarter_round(uint32_t& a, uint32_t& b, uint32_t& c, uint32_t& d);
     uint64_t get_os_entropy();
     void generate_block();
+    void generate_direct(uint32_t* out, size_t blocks);
     void check_reseed();
     void expand_seed(uint64_t seed, uint32_t* output, size_t count);
     
 public:
-    ChaChaRNG(uint64_t seed = 0);
-    ~ChaChaRNG();
+    BasicChaChaRNG(uint64_t seed = 0);
+    ~BasicChaChaRNG();
     void seed(uint64_t seed);
     uint32_t next_uint32();
     float next_float();
     uint32_t next_bounded(uint32_t bound);
     void next_bytes(uint8_t* buffer, size_t length);
+    void fill(uint32_t* out, size_t count);
+};
+
+using ChaChaRNG = BasicChaChaRNG<20>;
+using ChaCha12RNG = BasicChaChaRNG<12>;
+using ChaCha8RNG = BasicChaChaRNG<8>;
+
+extern template class BasicChaChaRNG<8>;
+extern template class BasicChaChaRNG<12>;
+extern template class BasicChaChaRNG<20>;
+
+// Per-script state, created when an AMX loads and freed when it unloads.
+// Only touched from the server thread, so no locking is needed.
+struct ScriptContext {
+    PRNGEngine prng;
+    PCG64 prng64;
+    int csprng_rounds = 20;
+    HandlePool<AliasTable> alias_tables;
+    HandlePool<WeightedSet> weighted_sets;
+    HandlePool<Deck> decks;
+    HandlePool<FeistelPermutation> permutations;
+    HandlePool<DiceExpression> dice_expressions;
+    HandlePool<Polygon> polygons;
+    HandlePool<Polyline> polylines;
+    HandlePool<ZoneSet> zone_sets;
+    // Expressions compiled by PRandDiceRoll, keyed by their text; cleared
+    // when it reaches DICE_CACHE_SIZE so scripts building strings can't grow it
+    static constexpr size_t DICE_CACHE_SIZE = 256;
+    std::unordered_map<std::string, DiceExpression> dice_cache;
+    
+    // Cached compiled form of text, nullptr if it does not parse
+    const DiceExpression* dice(const std::string& text);
+    
+    // Stream the engines were created on; kept across engine switches
+    uint64_t stream;
+    
+    ScriptContext(EngineKind engine, uint64_t seed, uint64_t stream);
+    
+    EngineKind engine() const { return static_cast<EngineKind>(prng.index()); }
+    void set_engine(EngineKind engine, uint64_t seed);
+    
+    // Reseeds every per-script engine so the whole script replays; the
+    // one-argument form uses each engine's default stream, so the same seed
+    // replays identically in any script
+    void seed(uint64_t seed);
+    void seed(uint64_t seed, uint64_t stream);
 };
 
 // Global Random Generators
@@ -62,4 +1517,145 @@ namespace RandomixGenerators {
     ChaChaRNG& GetCSPRNG();
     void SeedPRNG(uint64_t seed);
     void SeedCSPRNG(uint64_t seed);
-}
\ No newline at end of file
+    
+    // Per-script generators, keyed by AMX pointer
+    ScriptContext& CreateContext(const void* script);
+    void DestroyContext(const void* script);
+    ScriptContext& GetContext(const void* script);
+    
+    // Engine given to scripts that load from now on
+    void SetDefaultEngine(EngineKind engine);
+    EngineKind GetDefaultEngine();
+    bool ParseEngineName(const char* name, EngineKind& engine);
+    const char* EngineName(EngineKind engine);
+    
+    // Per-thread generators, each seeded from its own stream or key
+    PCG32& GetThreadPRNG();
+    ChaChaRNG& GetThreadCSPRNG();
+}
+
+// Locking policies for reaching the core generators
+namespace RandomixPolicy {
+    // Shared instance, no lock (everything runs on the server thread)
+    struct NoLock {};
+    // Shared instance guarded by its mutex
+    struct Mutex {};
+    // One instance per calling thread, never contended
+    struct ThreadLocal {};
+    
+#ifdef RANDOMIX_LOCK_POLICY
+    using Default = RANDOMIX_LOCK_POLICY;
+#else
+    using Default = Mutex;
+#endif
+}
+
+namespace RandomixGenerators {
+    template <typename Engine>
+    struct SharedGenerator;
+    
+    template <>
+    struct SharedGenerator<PCG32> {
+        static PCG32& instance() { return GetPRNG(); }
+        static PCG32& local() { return GetThreadPRNG(); }
+        static std::mutex& mutex() { return prng_mutex; }
+    };
+    
+    // Reduced-round variants keep their own shared instance and lock
+    template <int ROUNDS>
+    struct SharedGenerator<BasicChaChaRNG<ROUNDS>> {
+        static BasicChaChaRNG<ROUNDS>& instance() {
+            static BasicChaChaRNG<ROUNDS> rng(0);
+            return rng;
+        }
+        static BasicChaChaRNG<ROUNDS>& local() {
+            thread_local BasicChaChaRNG<ROUNDS> rng(0);
+            return rng;
+        }
+        static std::mutex& mutex() {
+            static std::mutex lock;
+            return lock;
+        }
+    };
+    
+    template <>
+    struct SharedGenerator<ChaChaRNG> {
+        static ChaChaRNG& instance() { return GetCSPRNG(); }
+        static ChaChaRNG& local() { return GetThreadCSPRNG(); }
+        static std::mutex& mutex() { return csprng_mutex; }
+    };
+    
+    // Scoped access to a core generator under the given policy, e.g.
+    //   RandomixGenerators::Access<ChaChaRNG> rng;
+    //   rng->next_uint32();
+    template <typename Engine, typename Policy = RandomixPolicy::Default>
+    class Access;
+    
+    template <typename Engine>
+    class Access<Engine, RandomixPolicy::NoLock> {
+    private:
+        Engine& rng_;
+        
+    public:
+        Access() : rng_(SharedGenerator<Engine>::instance()) {}
+        Access(const Access&) = delete;
+        Access& operator=(const Access&) = delete;
+        
+        Engine* operator->() { return &rng_; }
+        Engine& operator*() { return rng_; }
+    };
+    
+    template <typename Engine>
+    class Access<Engine, RandomixPolicy::Mutex> {
+    private:
+        std::lock_guard<std::mutex> lock_;
+        Engine& rng_;
+        
+    public:
+        Access() : lock_(SharedGenerator<Engine>::mutex()), rng_(SharedGenerator<Engine>::instance()) {}
+        Access(const Access&) = delete;
+        Access& operator=(const Access&) = delete;
+        
+        Engine* operator->() { return &rng_; }
+        Engine& operator*() { return rng_; }
+    };
+    
+    template <typename Engine>
+    class Access<Engine, RandomixPolicy::ThreadLocal> {
+    private:
+        Engine& rng_;
+        
+    public:
+        Access() : rng_(SharedGenerator<Engine>::local()) {}
+        Access(const Access&) = delete;
+        Access& operator=(const Access&) = delete;
+        
+        Engine* operator->() { return &rng_; }
+        Engine& operator*() { return rng_; }
+    };
+    
+    // Runs fn on the script's selected PRNG engine
+    template <typename F>
+    auto VisitPRNG(const void* script, F&& fn) -> decltype(fn(std::declval<PCG32&>())) {
+        return std::visit(std::forward<F>(fn), GetContext(script).prng);
+    }
+    
+    // Runs fn on the ChaCha variant selected by the script (8, 12 or 20 rounds)
+    template <typename F>
+    auto VisitCSPRNG(const void* script, F&& fn) -> decltype(fn(std::declval<ChaChaRNG&>())) {
+        switch (GetContext(script).csprng_rounds) {
+        case 8: {
+            Access<ChaCha8RNG> rng;
+            return fn(*rng);
+        }
+        case 12: {
+            Access<ChaCha12RNG> rng;
+            return fn(*rng);
+        }
+        default: {
+            Access<ChaChaRNG> rng;
+            return fn(*rng);
+        }
+        }
+    }
+}